@@ -12,6 +12,7 @@
 #include <errno.h>
 
 #include "GLUtil.h"
+#include "ShaderLibrary.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/vec2.hpp>
@@ -20,21 +21,20 @@
 #include <glm/mat4x4.hpp> // glm::mat4
 #include <glm/gtc/matrix_transform.hpp> // glm::translate, glm::rotate, glm::scale, glm::perspective
 #include <glm/gtc/constants.hpp> // glm::pi
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/affine_2d.hpp> // glm::affineOrtho
 
 // Vertice shader
 const char * VERTEX_SHADER = R"SHADER(
 #version 330 core
 
-layout(location = 0) in vec4 vPosition;
+#include "transform.glsl"
 
-uniform mat4 modelView;
-uniform mat4 project;
-uniform vec2 u_center;
+layout(location = 0) in vec4 vPosition;
 
 void
 main(){
-    vec4 pos = project * modelView * vec4(vPosition.xy / 1.0, 0, 1);
-    gl_Position = pos;
+    gl_Position = transform(vPosition.xy);
 }
 )SHADER";
 
@@ -42,8 +42,6 @@ main(){
 const char * FRAGMENT_SHADER = R"SHADER(
 #version 330 core
 
-#define feather 0.5
-
 uniform vec2 u_center;
 uniform float u_radius;
 out vec4 fColor;
@@ -65,6 +63,23 @@ const int SCREEN_WIDTH = 640;
 
 const int SCREEN_HEIGHT = 480;
 
+// Screen coordinates to clip space, y down. Built at compile time, the
+// corners checked below.
+constexpr glm::mat3x2 SCREEN_TO_CLIP = glm::affineOrtho(0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0.0f);
+static_assert(SCREEN_TO_CLIP[2].x == -1.0f && SCREEN_TO_CLIP[2].y == 1.0f, "top left corner is not (-1, 1)");
+constexpr glm::vec2 SCREEN_BOTTOM_RIGHT = SCREEN_TO_CLIP * glm::vec3(SCREEN_WIDTH, SCREEN_HEIGHT, 1);
+static_assert(SCREEN_BOTTOM_RIGHT.x == 1.0f && SCREEN_BOTTOM_RIGHT.y == -1.0f, "bottom right corner is not (1, -1)");
+#if GLM_ARCH == GLM_ARCH_PURE
+// mat4 and vec4 are only literal types without SIMD. The same transform
+// from ortho, and from translate times scale, must agree with it.
+constexpr glm::mat4 SCREEN_ORTHO = glm::ortho(0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0.0f);
+constexpr glm::mat4 SCREEN_TRANSLATE_SCALE = glm::translate(glm::mat4(1.0f), glm::vec3(-1.0f, 1.0f, 0.0f)) * glm::scale(glm::mat4(1.0f), glm::vec3(2.0f / SCREEN_WIDTH, -2.0f / SCREEN_HEIGHT, 1.0f));
+static_assert(SCREEN_ORTHO[0][0] == SCREEN_TO_CLIP[0][0] && SCREEN_ORTHO[1][1] == SCREEN_TO_CLIP[1][1] && SCREEN_ORTHO[3][0] == SCREEN_TO_CLIP[2][0] && SCREEN_ORTHO[3][1] == SCREEN_TO_CLIP[2][1], "ortho differs from affineOrtho");
+static_assert(SCREEN_TRANSLATE_SCALE[0][0] == SCREEN_ORTHO[0][0] && SCREEN_TRANSLATE_SCALE[1][1] == SCREEN_ORTHO[1][1] && SCREEN_TRANSLATE_SCALE[3][0] == SCREEN_ORTHO[3][0] && SCREEN_TRANSLATE_SCALE[3][1] == SCREEN_ORTHO[3][1], "translate * scale differs from ortho");
+constexpr glm::vec4 SCREEN_ORTHO_BOTTOM_RIGHT = SCREEN_ORTHO * glm::vec4(SCREEN_WIDTH, SCREEN_HEIGHT, 0, 1);
+static_assert(SCREEN_ORTHO_BOTTOM_RIGHT[0] == 1.0f && SCREEN_ORTHO_BOTTOM_RIGHT[1] == -1.0f, "bottom right corner is not (1, -1)");
+#endif
+
 GLuint program;
 GLuint vertexbuffer;
 
@@ -92,7 +107,9 @@ void initVertices(){
     glBindVertexArray(VertexArrayID);
 
     // Create and compile our GLSL program from the shaders
-    program = LoadShaders(VERTEX_SHADER, FRAGMENT_SHADER);
+    RegisterShaderSource("arc_fill.vert", VERTEX_SHADER);
+    RegisterShaderSource("arc_fill.frag", FRAGMENT_SHADER);
+    program = GetShaderProgram("arc_fill.vert", "arc_fill.frag");
 
     // Arc points
     glm::vec2 p1 = center;
@@ -250,16 +267,7 @@ void render(){
     // Use our shader
     glUseProgram(program);
 
-    // Ortho matrix
-    glm::mat4 modelView = glm::mat4(1.0f);
-    modelView = glm::translate(modelView, glm::vec3(0.0, 0.0, -1.0f));
-    GLint uniModelView = glGetUniformLocation(program, "modelView");
-    glUniformMatrix4fv(uniModelView, 1, GL_FALSE, glm::value_ptr(modelView));
-
-
-    glm::mat4 ortho = glm::ortho(0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0.0f, 0.1f, 100.0f);
-    GLint uniProj = glGetUniformLocation(program, "project");
-    glUniformMatrix4fv(uniProj, 1, GL_FALSE, glm::value_ptr(ortho));
+    SetTransform(program, SCREEN_TO_CLIP);
 
     GLint uniRadius = glGetUniformLocation(program, "u_radius");
     glUniform1f(uniRadius, radius);
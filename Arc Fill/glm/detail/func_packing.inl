@@ -5,6 +5,129 @@
 #include "type_half.hpp"
 #include "../fwd.hpp"
 
+namespace glm{
+namespace detail
+{
+	// Scalar versions of the functions func_packing_simd.inl has kernels for
+	template<bool UseSimd = (GLM_ARCH & GLM_ARCH_SSE2_BIT) != 0>
+	struct compute_packSnorm2x16
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec2 const& v)
+		{
+			union
+			{
+				i16  in[2];
+				uint out;
+			} u;
+
+			i16vec2 result(round(clamp(v, -1.0f, 1.0f) * 32767.0f));
+
+			u.in[0] = result[0];
+			u.in[1] = result[1];
+
+			return u.out;
+		}
+	};
+
+	template<bool UseSimd = (GLM_ARCH & GLM_ARCH_SSE2_BIT) != 0>
+	struct compute_unpackSnorm2x16
+	{
+		GLM_FUNC_QUALIFIER static vec2 call(uint p)
+		{
+			union
+			{
+				uint in;
+				i16  out[2];
+			} u;
+
+			u.in = p;
+
+			return clamp(vec2(u.out[0], u.out[1]) * 3.0518509475997192297128208258309e-5f, -1.0f, 1.0f);
+		}
+	};
+
+	template<bool UseSimd = (GLM_ARCH & GLM_ARCH_SSE2_BIT) != 0>
+	struct compute_packUnorm4x8
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec4 const& v)
+		{
+			union
+			{
+				u8   in[4];
+				uint out;
+			} u;
+
+			u8vec4 result(round(clamp(v, 0.0f, 1.0f) * 255.0f));
+
+			u.in[0] = result[0];
+			u.in[1] = result[1];
+			u.in[2] = result[2];
+			u.in[3] = result[3];
+
+			return u.out;
+		}
+	};
+
+	template<bool UseSimd = (GLM_ARCH & GLM_ARCH_SSE2_BIT) != 0>
+	struct compute_unpackUnorm4x8
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint p)
+		{
+			union
+			{
+				uint in;
+				u8   out[4];
+			} u;
+
+			u.in = p;
+
+			return vec4(u.out[0], u.out[1], u.out[2], u.out[3]) * 0.0039215686274509803921568627451f;
+		}
+	};
+
+	template<bool UseSimd = (GLM_ARCH & GLM_ARCH_SSE2_BIT) != 0>
+	struct compute_packHalf2x16
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec2 const& v)
+		{
+			union
+			{
+				i16  in[2];
+				uint out;
+			} u;
+
+			u.in[0] = detail::toFloat16(v.x);
+			u.in[1] = detail::toFloat16(v.y);
+
+			return u.out;
+		}
+	};
+
+	template<bool UseSimd = (GLM_ARCH & GLM_ARCH_SSE2_BIT) != 0>
+	struct compute_unpackHalf2x16
+	{
+		GLM_FUNC_QUALIFIER static vec2 call(uint v)
+		{
+			union
+			{
+				uint in;
+				i16  out[2];
+			} u;
+
+			u.in = v;
+
+			return vec2(
+				detail::toFloat32(u.out[0]),
+				detail::toFloat32(u.out[1]));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_UNRESTRICTED_UNIONS
+#	include "func_packing_simd.inl"
+#endif
+
 namespace glm
 {
 	GLM_FUNC_QUALIFIER uint packUnorm2x16(vec2 const& v)
@@ -38,62 +161,22 @@ namespace glm
 
 	GLM_FUNC_QUALIFIER uint packSnorm2x16(vec2 const& v)
 	{
-		union
-		{
-			i16  in[2];
-			uint out;
-		} u;
-
-		i16vec2 result(round(clamp(v, -1.0f, 1.0f) * 32767.0f));
-
-		u.in[0] = result[0];
-		u.in[1] = result[1];
-
-		return u.out;
+		return detail::compute_packSnorm2x16<>::call(v);
 	}
 
 	GLM_FUNC_QUALIFIER vec2 unpackSnorm2x16(uint p)
 	{
-		union
-		{
-			uint in;
-			i16  out[2];
-		} u;
-
-		u.in = p;
-
-		return clamp(vec2(u.out[0], u.out[1]) * 3.0518509475997192297128208258309e-5f, -1.0f, 1.0f);
+		return detail::compute_unpackSnorm2x16<>::call(p);
 	}
 
 	GLM_FUNC_QUALIFIER uint packUnorm4x8(vec4 const& v)
 	{
-		union
-		{
-			u8   in[4];
-			uint out;
-		} u;
-
-		u8vec4 result(round(clamp(v, 0.0f, 1.0f) * 255.0f));
-
-		u.in[0] = result[0];
-		u.in[1] = result[1];
-		u.in[2] = result[2];
-		u.in[3] = result[3];
-
-		return u.out;
+		return detail::compute_packUnorm4x8<>::call(v);
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackUnorm4x8(uint p)
 	{
-		union
-		{
-			uint in;
-			u8   out[4];
-		} u;
-
-		u.in = p;
-
-		return vec4(u.out[0], u.out[1], u.out[2], u.out[3]) * 0.0039215686274509803921568627451f;
+		return detail::compute_unpackUnorm4x8<>::call(p);
 	}
 	
 	GLM_FUNC_QUALIFIER uint packSnorm4x8(vec4 const& v)
@@ -156,35 +239,12 @@ namespace glm
 
 	GLM_FUNC_QUALIFIER uint packHalf2x16(vec2 const& v)
 	{
-		union
-		{
-			i16  in[2];
-			uint out;
-		} u;
-
-		u.in[0] = detail::toFloat16(v.x);
-		u.in[1] = detail::toFloat16(v.y);
-
-		return u.out;
+		return detail::compute_packHalf2x16<>::call(v);
 	}
 
 	GLM_FUNC_QUALIFIER vec2 unpackHalf2x16(uint v)
 	{
-		union
-		{
-			uint in;
-			i16  out[2];
-		} u;
-
-		u.in = v;
-
-		return vec2(
-			detail::toFloat32(u.out[0]),
-			detail::toFloat32(u.out[1]));
+		return detail::compute_unpackHalf2x16<>::call(v);
 	}
 }//namespace glm
 
-#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_UNRESTRICTED_UNIONS
-#	include "func_packing_simd.inl"
-#endif
-
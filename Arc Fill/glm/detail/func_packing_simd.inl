@@ -1,9 +1,76 @@
 /// @ref core
 /// @file glm/detail/func_packing_simd.inl
 
+#include "../simd/packing.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
 namespace glm{
 namespace detail
 {
+	template<>
+	struct compute_packSnorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec2 const& v)
+		{
+			glm_vec4 const xy = _mm_set_ps(0.0f, 0.0f, v.y, v.x);
+			return static_cast<uint>(_mm_cvtsi128_si32(glm_vec4_packSnorm16(xy, xy)));
+		}
+	};
+
+	template<>
+	struct compute_unpackSnorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec2 call(uint p)
+		{
+			float Result[4];
+			_mm_storeu_ps(Result, glm_vec4_unpackSnorm16(_mm_cvtsi32_si128(static_cast<int>(p))));
+			return vec2(Result[0], Result[1]);
+		}
+	};
+
+	template<>
+	struct compute_packUnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec4 const& v)
+		{
+			glm_vec4 const xyzw = _mm_loadu_ps(&v.x);
+			return static_cast<uint>(_mm_cvtsi128_si32(glm_vec4_packUnorm8(xyzw, xyzw, xyzw, xyzw)));
+		}
+	};
 
+	template<>
+	struct compute_unpackUnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint p)
+		{
+			vec4 Result;
+			_mm_storeu_ps(&Result.x, glm_vec4_unpackUnorm8(_mm_cvtsi32_si128(static_cast<int>(p))));
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_packHalf2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec2 const& v)
+		{
+			glm_vec4 const xy = _mm_set_ps(0.0f, 0.0f, v.y, v.x);
+			return static_cast<uint>(_mm_cvtsi128_si32(glm_vec4_packHalf(xy)));
+		}
+	};
+
+	template<>
+	struct compute_unpackHalf2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec2 call(uint v)
+		{
+			float Result[4];
+			_mm_storeu_ps(Result, glm_vec4_unpackHalf(_mm_cvtsi32_si128(static_cast<int>(v))));
+			return vec2(Result[0], Result[1]);
+		}
+	};
 }//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,90 @@
+/// @ref gtx_affine_2d
+/// @file glm/gtx/affine_2d.inl
+
+#include "../trigonometric.hpp"
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q>
+	struct compute_affineInverse
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 2, T, Q> call(mat<3, 2, T, Q> const& m)
+		{
+			T const Determinant = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+			vec<2, T, Q> const Inverse0(m[1][1] / Determinant, -m[0][1] / Determinant);
+			vec<2, T, Q> const Inverse1(-m[1][0] / Determinant, m[0][0] / Determinant);
+			return mat<3, 2, T, Q>(Inverse0, Inverse1, -(Inverse0 * m[2].x + Inverse1 * m[2].y));
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_affineInverse<float, Q>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 2, float, Q> call(mat<3, 2, float, Q> const& m)
+		{
+			glm_vec4 const trn = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const*>(&m[2].x)));
+
+			glm_vec4 lin0, trn0;
+			glm_mat3x2_inverse(_mm_loadu_ps(&m[0].x), _mm_movelh_ps(trn, trn), &lin0, &trn0);
+
+			mat<3, 2, float, Q> Result;
+			_mm_storeu_ps(&Result[0].x, lin0);
+			_mm_storel_pi(reinterpret_cast<__m64*>(&Result[2].x), trn0);
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 2, T, defaultp> affineOrtho(T left, T right, T bottom, T top)
+	{
+		return mat<3, 2, T, defaultp>(
+			static_cast<T>(2) / (right - left), static_cast<T>(0),
+			static_cast<T>(0), static_cast<T>(2) / (top - bottom),
+			- (right + left) / (right - left), - (top + bottom) / (top - bottom));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 2, T, Q> affineCompose(mat<3, 2, T, Q> const& a, mat<3, 2, T, Q> const& b)
+	{
+		return mat<3, 2, T, Q>(
+			a[0] * b[0].x + a[1] * b[0].y,
+			a[0] * b[1].x + a[1] * b[1].y,
+			a[0] * b[2].x + a[1] * b[2].y + a[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> affineInverse(mat<3, 2, T, Q> const& m)
+	{
+		return detail::compute_affineInverse<T, Q>::call(m);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 2, T, Q> affineTranslate(mat<3, 2, T, Q> const& m, vec<2, T, Q> const& v)
+	{
+		return mat<3, 2, T, Q>(m[0], m[1], m[0] * v.x + m[1] * v.y + m[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> affineRotate(mat<3, 2, T, Q> const& m, T angle)
+	{
+		T const c = cos(angle);
+		T const s = sin(angle);
+
+		mat<3, 2, T, Q> Result;
+		Result[0] = m[0] * c + m[1] * s;
+		Result[1] = m[0] * -s + m[1] * c;
+		Result[2] = m[2];
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 2, T, Q> affineScale(mat<3, 2, T, Q> const& m, vec<2, T, Q> const& v)
+	{
+		return mat<3, 2, T, Q>(m[0] * v.x, m[1] * v.y, m[2]);
+	}
+}//namespace glm
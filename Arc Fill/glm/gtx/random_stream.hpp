@@ -0,0 +1,89 @@
+/// @ref gtx_random_stream
+/// @file glm/gtx/random_stream.hpp
+///
+/// @see core (dependence)
+/// @see gtc_random (dependence)
+///
+/// @defgroup gtx_random_stream GLM_GTX_random_stream
+/// @ingroup gtx
+///
+/// Include <glm/gtx/random_stream.hpp> to use the features of this extension.
+///
+/// The linearRand, circularRand and diskRand of gtc_random filling whole
+/// arrays from an explicit generator instead of std::rand, for generating
+/// benchmark scenes and test data. A randomStream is eight xoshiro128+
+/// generators stepped together, so a SIMD register of draws costs a few
+/// integer instructions. The same seed gives the same values on every
+/// platform and in every build, SSE2, AVX2 or GLM_FORCE_PURE. Points are
+/// written as a structure of arrays, all x then all y.
+///
+/// A randomStream is not shared between threads. Give thread t its own
+/// randomStream(seed, t): the streams of one seed are independent of each
+/// other, and the scene only depends on the seed and how it is split.
+
+#pragma once
+
+// Dependency:
+#include "../gtc/random.hpp"
+#include "../vec2.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_random_stream is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_random_stream extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_random_stream
+	/// @{
+
+	/// Eight xoshiro128+ generators. The functions below draw from all of
+	/// them at once, eight numbers a step, and leave the rest of the last
+	/// step unused: a stream gives the same values again for the same
+	/// sequence of calls and counts.
+	///
+	/// @see gtx_random_stream
+	struct randomStream
+	{
+		/// Seeds the generators with splitmix64 from seed and stream.
+		/// Different streams of a seed never overlap in practice.
+		GLM_FUNC_DECL explicit randomStream(uint64 seed = 0, uint64 stream = 0);
+
+		/// state[w][l] is word w of generator l
+		uint32 state[4][8];
+	};
+
+	/// Writes count floats uniformly distributed in [min, max) to out,
+	/// with 24 random bits each.
+	///
+	/// @see gtx_random_stream
+	GLM_FUNC_DECL void linearRand(randomStream& stream, float min, float max, float* out, std::size_t count);
+
+	/// Writes count points uniformly distributed in the box from min to max.
+	///
+	/// @see gtx_random_stream
+	GLM_FUNC_DECL void linearRand(randomStream& stream, vec2 const& min, vec2 const& max, float* x, float* y, std::size_t count);
+
+	/// Writes count points uniformly distributed on a circle of radius
+	/// radius around the origin. The angles are within 2e-7 radians of
+	/// cos and sin.
+	///
+	/// @see gtx_random_stream
+	GLM_FUNC_DECL void circularRand(randomStream& stream, float radius, float* x, float* y, std::size_t count);
+
+	/// Writes count points uniformly distributed in a disk of radius
+	/// radius around the origin. Each point takes an angle and
+	/// radius * sqrt(u), a fixed two draws where the diskRand of gtc_random
+	/// retries until it hits the disk.
+	///
+	/// @see gtx_random_stream
+	GLM_FUNC_DECL void diskRand(randomStream& stream, float radius, float* x, float* y, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "random_stream.inl"
@@ -0,0 +1,180 @@
+/// @ref gtx_random_stream
+/// @file glm/gtx/random_stream.inl
+
+#include "../gtc/ulp.hpp"
+#include "../simd/random.h"
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	// Points per round of the functions below, their draws fit in a
+	// buffer of 512 floats on the stack
+	static std::size_t const RandomChunk = 256;
+
+	GLM_FUNC_QUALIFIER uint64 splitmix64(uint64& x)
+	{
+		x += static_cast<uint64>(0x9E3779B97F4A7C15ull);
+		uint64 z = x;
+		z = (z ^ (z >> 30)) * static_cast<uint64>(0xBF58476D1CE4E5B9ull);
+		z = (z ^ (z >> 27)) * static_cast<uint64>(0x94D049BB133111EBull);
+		return z ^ (z >> 31);
+	}
+
+	// steps draws of the eight generators: out[8 * k + l] is draw k of
+	// generator l
+	GLM_FUNC_QUALIFIER void randomDraws(randomStream& stream, float* out, std::size_t steps)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_random_uniform(stream.state, out, steps);
+#		else
+			uint32 (&s)[4][8] = stream.state;
+			for(std::size_t k = 0; k < steps; ++k)
+				for(int l = 0; l < 8; ++l)
+				{
+					uint32 const Result = s[0][l] + s[3][l];
+					uint32 const t = s[1][l] << 9;
+					s[2][l] ^= s[0][l];
+					s[3][l] ^= s[1][l];
+					s[1][l] ^= s[2][l];
+					s[0][l] ^= s[3][l];
+					s[2][l] ^= t;
+					s[3][l] = (s[3][l] << 11) | (s[3][l] >> 21);
+					out[k * 8 + l] = static_cast<float>(Result >> 8) * (1.0f / 16777216.0f);
+				}
+#		endif
+	}
+
+	// glm_vec4_sincos_turns on one value, the same operations in the same
+	// order
+	GLM_FUNC_QUALIFIER void sincosTurns(float u, float& c, float& s)
+	{
+		float const t = u * 4.0f;
+		int const q = static_cast<int>(t + 0.5f);
+		float const x = (t - static_cast<float>(q)) * 1.57079637f;
+		float const x2 = x * x;
+
+		float const Sin = (x * x2) * ((x2 * (x2 * -1.9515295891e-4f + 8.3321608736e-3f)) + -1.6666654611e-1f) + x;
+		float const Cos = (x2 * x2) * ((x2 * (x2 * 2.443315711809948e-5f + -1.388731625493765e-3f)) + 4.166664568298827e-2f) + (1.0f - x2 * 0.5f);
+
+		c = q & 1 ? Sin : Cos;
+		s = q & 1 ? Cos : Sin;
+		if((q + 1) & 2)
+			c = -c;
+		if(q & 2)
+			s = -s;
+	}
+
+	// Points at radius times radii[i] and angle 2 pi turns[i]; radii null
+	// stands for radius 1
+	GLM_FUNC_QUALIFIER void polarPoints(float const* turns, float const* radii, float radius, float* x, float* y, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 c, s;
+				glm_vec4_sincos_turns(_mm_loadu_ps(turns + i), &c, &s);
+				glm_vec4 const r = radii ? _mm_mul_ps(_mm_set1_ps(radius), _mm_sqrt_ps(_mm_loadu_ps(radii + i))) : _mm_set1_ps(radius);
+				_mm_storeu_ps(x + i, _mm_mul_ps(c, r));
+				_mm_storeu_ps(y + i, _mm_mul_ps(s, r));
+			}
+#		endif
+		for(; i < count; ++i)
+		{
+			float c, s;
+			sincosTurns(turns[i], c, s);
+			float const r = radii ? radius * std::sqrt(radii[i]) : radius;
+			x[i] = c * r;
+			y[i] = s * r;
+		}
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER randomStream::randomStream(uint64 seed, uint64 stream)
+	{
+		uint64 Stream = stream;
+		uint64 x = seed ^ detail::splitmix64(Stream);
+		for(int l = 0; l < 8; ++l)
+		{
+			uint64 const a = detail::splitmix64(x);
+			uint64 const b = detail::splitmix64(x);
+			state[0][l] = static_cast<uint32>(a);
+			state[1][l] = static_cast<uint32>(a >> 32);
+			state[2][l] = static_cast<uint32>(b);
+			state[3][l] = static_cast<uint32>(b >> 32);
+
+			// xoshiro never leaves the all zero state
+			if(a == 0 && b == 0)
+				state[0][l] = 1;
+		}
+	}
+
+	// min + Draw * Range can round up to max when the range is narrow next
+	// to min, so results stop at the float below it
+	GLM_FUNC_QUALIFIER void linearRand(randomStream& stream, float min, float max, float* out, std::size_t count)
+	{
+		float Draws[detail::RandomChunk * 2];
+		float const Range = max - min;
+		float const Last = min < max ? prev_float(max) : min;
+		for(std::size_t First = 0; First < count; First += detail::RandomChunk * 2)
+		{
+			std::size_t const n = count - First < detail::RandomChunk * 2 ? count - First : detail::RandomChunk * 2;
+			detail::randomDraws(stream, Draws, (n + 7) / 8);
+			for(std::size_t i = 0; i < n; ++i)
+			{
+				float const Value = min + Draws[i] * Range;
+				out[First + i] = Value < Last ? Value : Last;
+			}
+		}
+	}
+
+	// Each group of eight points takes a step for x, then one for y
+	GLM_FUNC_QUALIFIER void linearRand(randomStream& stream, vec2 const& min, vec2 const& max, float* x, float* y, std::size_t count)
+	{
+		float Draws[detail::RandomChunk * 2];
+		vec2 const Range = max - min;
+		vec2 const Last(min.x < max.x ? prev_float(max.x) : min.x, min.y < max.y ? prev_float(max.y) : min.y);
+		for(std::size_t First = 0; First < count; First += detail::RandomChunk)
+		{
+			std::size_t const n = count - First < detail::RandomChunk ? count - First : detail::RandomChunk;
+			detail::randomDraws(stream, Draws, (n + 7) / 8 * 2);
+			for(std::size_t i = 0; i < n; ++i)
+			{
+				std::size_t const Draw = i / 8 * 16 + i % 8;
+				float const ValueX = min.x + Draws[Draw] * Range.x;
+				float const ValueY = min.y + Draws[Draw + 8] * Range.y;
+				x[First + i] = ValueX < Last.x ? ValueX : Last.x;
+				y[First + i] = ValueY < Last.y ? ValueY : Last.y;
+			}
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void circularRand(randomStream& stream, float radius, float* x, float* y, std::size_t count)
+	{
+		float Draws[detail::RandomChunk];
+		for(std::size_t First = 0; First < count; First += detail::RandomChunk)
+		{
+			std::size_t const n = count - First < detail::RandomChunk ? count - First : detail::RandomChunk;
+			detail::randomDraws(stream, Draws, (n + 7) / 8);
+			detail::polarPoints(Draws, NULL, radius, x + First, y + First, n);
+		}
+	}
+
+	// Each group of eight points takes a step for the angles, then one for
+	// the radii
+	GLM_FUNC_QUALIFIER void diskRand(randomStream& stream, float radius, float* x, float* y, std::size_t count)
+	{
+		float Draws[detail::RandomChunk * 2];
+		for(std::size_t First = 0; First < count; First += detail::RandomChunk)
+		{
+			std::size_t const n = count - First < detail::RandomChunk ? count - First : detail::RandomChunk;
+			detail::randomDraws(stream, Draws, (n + 7) / 8 * 2);
+			for(std::size_t i = 0; i < n; i += 8)
+			{
+				std::size_t const Group = n - i < 8 ? n - i : 8;
+				detail::polarPoints(Draws + i * 2, Draws + i * 2 + 8, radius, x + First + i, y + First + i, Group);
+			}
+		}
+	}
+}//namespace glm
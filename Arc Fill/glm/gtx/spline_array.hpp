@@ -0,0 +1,89 @@
+/// @ref gtx_spline_array
+/// @file glm/gtx/spline_array.hpp
+///
+/// @see core (dependence)
+/// @see gtx_spline (dependence)
+///
+/// @defgroup gtx_spline_array GLM_GTX_spline_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/spline_array.hpp> to use the features of this extension.
+///
+/// The 2D curves of gtx_spline sampled at many evenly spaced parameters at
+/// once, for smoothing pen input and densifying polylines. A span is turned
+/// into its polynomial once and then stepped by forward differencing, three
+/// additions per coordinate and point instead of a full evaluation. Points
+/// are written as a structure of arrays, all x then all y. The segment
+/// counts come from the curvature of the span: enough chords to stay
+/// within a tolerance of the curve.
+
+#pragma once
+
+// Dependency:
+#include "../gtx/spline.hpp"
+#include "../vec2.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_spline_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_spline_array extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_spline_array
+	/// @{
+
+	/// Writes catmullRom(v1, v2, v3, v4, s) for s = 0, 1 / segments, ...,
+	/// (segments - 1) / segments to x and y, segments points. The end point
+	/// v3 is left out, so consecutive spans sample a curve without repeating
+	/// points. Matches catmullRom to within 6e-6 of the size of the span,
+	/// plus the rounding of each point to float at its coordinates.
+	///
+	/// @see gtx_spline_array
+	GLM_FUNC_DECL void catmullRom(
+		vec2 const& v1, vec2 const& v2, vec2 const& v3, vec2 const& v4,
+		std::size_t segments, float* x, float* y);
+
+	/// hermite(v1, t1, v2, t2, s) at the parameters of catmullRom above.
+	///
+	/// @see gtx_spline_array
+	GLM_FUNC_DECL void hermite(
+		vec2 const& v1, vec2 const& t1, vec2 const& v2, vec2 const& t2,
+		std::size_t segments, float* x, float* y);
+
+	/// cubic(v1, v2, v3, v4, s) at the parameters of catmullRom above.
+	///
+	/// @see gtx_spline_array
+	GLM_FUNC_DECL void cubic(
+		vec2 const& v1, vec2 const& v2, vec2 const& v3, vec2 const& v4,
+		std::size_t segments, float* x, float* y);
+
+	/// Chords needed for the catmullRom span from v2 to v3 to stay within
+	/// tolerance of the curve: sqrt(max |curve''| / (8 * tolerance)), at
+	/// least 1 and at most 1024. 1 when the whole span stays within
+	/// tolerance of the chord from v2 to v3, as straight runs do.
+	///
+	/// @see gtx_spline_array
+	GLM_FUNC_DECL std::size_t catmullRomSegments(
+		vec2 const& v1, vec2 const& v2, vec2 const& v3, vec2 const& v4, float tolerance);
+
+	/// catmullRomSegments for the hermite span.
+	///
+	/// @see gtx_spline_array
+	GLM_FUNC_DECL std::size_t hermiteSegments(
+		vec2 const& v1, vec2 const& t1, vec2 const& v2, vec2 const& t2, float tolerance);
+
+	/// catmullRomSegments for the cubic span.
+	///
+	/// @see gtx_spline_array
+	GLM_FUNC_DECL std::size_t cubicSegments(
+		vec2 const& v1, vec2 const& v2, vec2 const& v3, vec2 const& v4, float tolerance);
+
+	/// @}
+}//namespace glm
+
+#include "spline_array.inl"
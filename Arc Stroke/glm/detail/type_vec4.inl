@@ -37,7 +37,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_vec4_add
 	{
-		GLM_FUNC_QUALIFIER static vec<4, T, Q> call(vec<4, T, Q> const& a, vec<4, T, Q> const& b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_SIMD vec<4, T, Q> call(vec<4, T, Q> const& a, vec<4, T, Q> const& b)
 		{
 			return vec<4, T, Q>(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
 		}
@@ -46,7 +46,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_vec4_sub
 	{
-		GLM_FUNC_QUALIFIER static vec<4, T, Q> call(vec<4, T, Q> const& a, vec<4, T, Q> const& b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_SIMD vec<4, T, Q> call(vec<4, T, Q> const& a, vec<4, T, Q> const& b)
 		{
 			return vec<4, T, Q>(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
 		}
@@ -55,7 +55,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_vec4_mul
 	{
-		GLM_FUNC_QUALIFIER static vec<4, T, Q> call(vec<4, T, Q> const& a, vec<4, T, Q> const& b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_SIMD vec<4, T, Q> call(vec<4, T, Q> const& a, vec<4, T, Q> const& b)
 		{
 			return vec<4, T, Q>(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
 		}
@@ -64,7 +64,7 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_vec4_div
 	{
-		GLM_FUNC_QUALIFIER static vec<4, T, Q> call(vec<4, T, Q> const& a, vec<4, T, Q> const& b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_SIMD vec<4, T, Q> call(vec<4, T, Q> const& a, vec<4, T, Q> const& b)
 		{
 			return vec<4, T, Q>(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 		}
@@ -329,10 +329,10 @@ namespace detail
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER T const& vec<4, T, Q>::operator[](typename vec<4, T, Q>::length_type i) const
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD T const& vec<4, T, Q>::operator[](typename vec<4, T, Q>::length_type i) const
 	{
-		assert(i >= 0 && i < this->length());
-		return (&x)[i];
+		return assert(i >= 0 && i < this->length()),
+			GLM_IS_CONSTANT(i) ? (i == 0 ? x : (i == 1 ? y : (i == 2 ? z : w))) : (&x)[i];
 	}
 
 	// -- Unary arithmetic operators --
@@ -613,137 +613,137 @@ namespace detail
 	// -- Unary constant operators --
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator+(vec<4, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator+(vec<4, T, Q> const& v)
 	{
 		return v;
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator-(vec<4, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator-(vec<4, T, Q> const& v)
 	{
-		return vec<4, T, Q>(0) -= v;
+		return detail::compute_vec4_sub<T, Q, detail::is_aligned<Q>::value>::call(vec<4, T, Q>(0), v);
 	}
 
 	// -- Binary arithmetic operators --
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator+(vec<4, T, Q> const& v, T scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator+(vec<4, T, Q> const& v, T scalar)
 	{
-		return vec<4, T, Q>(v) += scalar;
+		return detail::compute_vec4_add<T, Q, detail::is_aligned<Q>::value>::call(v, vec<4, T, Q>(scalar));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator+(vec<4, T, Q> const& v1, vec<1, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator+(vec<4, T, Q> const& v1, vec<1, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v1) += v2;
+		return detail::compute_vec4_add<T, Q, detail::is_aligned<Q>::value>::call(v1, vec<4, T, Q>(v2.x));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator+(T scalar, vec<4, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator+(T scalar, vec<4, T, Q> const& v)
 	{
-		return vec<4, T, Q>(v) += scalar;
+		return detail::compute_vec4_add<T, Q, detail::is_aligned<Q>::value>::call(v, vec<4, T, Q>(scalar));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator+(vec<1, T, Q> const& v1, vec<4, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator+(vec<1, T, Q> const& v1, vec<4, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v2) += v1;
+		return detail::compute_vec4_add<T, Q, detail::is_aligned<Q>::value>::call(v2, vec<4, T, Q>(v1.x));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator+(vec<4, T, Q> const& v1, vec<4, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator+(vec<4, T, Q> const& v1, vec<4, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v1) += v2;
+		return detail::compute_vec4_add<T, Q, detail::is_aligned<Q>::value>::call(v1, v2);
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator-(vec<4, T, Q> const& v, T scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator-(vec<4, T, Q> const& v, T scalar)
 	{
-		return vec<4, T, Q>(v) -= scalar;
+		return detail::compute_vec4_sub<T, Q, detail::is_aligned<Q>::value>::call(v, vec<4, T, Q>(scalar));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator-(vec<4, T, Q> const& v1, vec<1, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator-(vec<4, T, Q> const& v1, vec<1, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v1) -= v2;
+		return detail::compute_vec4_sub<T, Q, detail::is_aligned<Q>::value>::call(v1, vec<4, T, Q>(v2.x));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator-(T scalar, vec<4, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator-(T scalar, vec<4, T, Q> const& v)
 	{
-		return vec<4, T, Q>(scalar) -= v;
+		return detail::compute_vec4_sub<T, Q, detail::is_aligned<Q>::value>::call(vec<4, T, Q>(scalar), v);
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator-(vec<1, T, Q> const& v1, vec<4, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator-(vec<1, T, Q> const& v1, vec<4, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v1.x) -= v2;
+		return detail::compute_vec4_sub<T, Q, detail::is_aligned<Q>::value>::call(vec<4, T, Q>(v1.x), v2);
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator-(vec<4, T, Q> const& v1, vec<4, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator-(vec<4, T, Q> const& v1, vec<4, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v1) -= v2;
+		return detail::compute_vec4_sub<T, Q, detail::is_aligned<Q>::value>::call(v1, v2);
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator*(vec<4, T, Q> const& v, T scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator*(vec<4, T, Q> const& v, T scalar)
 	{
-		return vec<4, T, Q>(v) *= scalar;
+		return detail::compute_vec4_mul<T, Q, detail::is_aligned<Q>::value>::call(v, vec<4, T, Q>(scalar));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator*(vec<4, T, Q> const& v1, vec<1, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator*(vec<4, T, Q> const& v1, vec<1, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v1) *= v2;
+		return detail::compute_vec4_mul<T, Q, detail::is_aligned<Q>::value>::call(v1, vec<4, T, Q>(v2.x));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator*(T scalar, vec<4, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator*(T scalar, vec<4, T, Q> const& v)
 	{
-		return vec<4, T, Q>(v) *= scalar;
+		return detail::compute_vec4_mul<T, Q, detail::is_aligned<Q>::value>::call(v, vec<4, T, Q>(scalar));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator*(vec<1, T, Q> const& v1, vec<4, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator*(vec<1, T, Q> const& v1, vec<4, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v2) *= v1;
+		return detail::compute_vec4_mul<T, Q, detail::is_aligned<Q>::value>::call(v2, vec<4, T, Q>(v1.x));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator*(vec<4, T, Q> const& v1, vec<4, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator*(vec<4, T, Q> const& v1, vec<4, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v1) *= v2;
+		return detail::compute_vec4_mul<T, Q, detail::is_aligned<Q>::value>::call(v1, v2);
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator/(vec<4, T, Q> const& v, T scalar)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator/(vec<4, T, Q> const& v, T scalar)
 	{
-		return vec<4, T, Q>(v) /= scalar;
+		return detail::compute_vec4_div<T, Q, detail::is_aligned<Q>::value>::call(v, vec<4, T, Q>(scalar));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator/(vec<4, T, Q> const& v1, vec<1, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator/(vec<4, T, Q> const& v1, vec<1, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v1) /= v2;
+		return detail::compute_vec4_div<T, Q, detail::is_aligned<Q>::value>::call(v1, vec<4, T, Q>(v2.x));
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator/(T scalar, vec<4, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator/(T scalar, vec<4, T, Q> const& v)
 	{
-		return vec<4, T, Q>(scalar) /= v;
+		return detail::compute_vec4_div<T, Q, detail::is_aligned<Q>::value>::call(vec<4, T, Q>(scalar), v);
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator/(vec<1, T, Q> const& v1, vec<4, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator/(vec<1, T, Q> const& v1, vec<4, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v1.x) /= v2;
+		return detail::compute_vec4_div<T, Q, detail::is_aligned<Q>::value>::call(vec<4, T, Q>(v1.x), v2);
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER vec<4, T, Q> operator/(vec<4, T, Q> const& v1, vec<4, T, Q> const& v2)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD vec<4, T, Q> operator/(vec<4, T, Q> const& v1, vec<4, T, Q> const& v2)
 	{
-		return vec<4, T, Q>(v1) /= v2;
+		return detail::compute_vec4_div<T, Q, detail::is_aligned<Q>::value>::call(v1, v2);
 	}
 
 	// -- Binary bit operators --
@@ -0,0 +1,67 @@
+/// @ref gtx_color_space_array
+/// @file glm/gtx/color_space_array.hpp
+///
+/// @see core (dependence)
+/// @see gtc_color_space (dependence)
+/// @see gtc_type_precision (dependence)
+///
+/// @defgroup gtx_color_space_array GLM_GTX_color_space_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/color_space_array.hpp> to use the features of this extension.
+///
+/// sRGB encoding and decoding of whole arrays of 8 bit colors, for
+/// framebuffer readback, image export and vertex colors. Decoding looks
+/// each code up in a table of 256 floats. Encoding finds the code from the
+/// exponent and top mantissa bits of the linear value with two small
+/// tables instead of a pow per component, 4 values at a time with SSE2
+/// and 8 with AVX2 gathers. Both follow IEC 61966-2-1 exactly, with codes
+/// rounded to nearest, and every build gives the same bits.
+
+#pragma once
+
+// Dependency:
+#include "../gtc/color_space.hpp"
+#include "../gtc/type_precision.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_color_space_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_color_space_array extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_color_space_array
+	/// @{
+
+	/// sRGB codes of count linear values, each clamped to [0, 1] and
+	/// rounded to the nearest code. NaN encodes to 0.
+	///
+	/// @see gtx_color_space_array
+	GLM_FUNC_DECL void convertLinearToSRGB(float const* linear, u8* srgb, std::size_t count);
+
+	/// count linear RGBA colors to sRGB. Alpha is not a color and is packed
+	/// as packUnorm4x8 does.
+	///
+	/// @see gtx_color_space_array
+	GLM_FUNC_DECL void convertLinearToSRGB(vec4 const* linear, u8vec4* srgb, std::size_t count);
+
+	/// Linear values of count sRGB codes.
+	///
+	/// @see gtx_color_space_array
+	GLM_FUNC_DECL void convertSRGBToLinear(u8 const* srgb, float* linear, std::size_t count);
+
+	/// count sRGB colors to linear RGBA. Alpha is unpacked as unpackUnorm4x8
+	/// does.
+	///
+	/// @see gtx_color_space_array
+	GLM_FUNC_DECL void convertSRGBToLinear(u8vec4 const* srgb, vec4* linear, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "color_space_array.inl"
@@ -0,0 +1,204 @@
+/// @ref gtx_intersect_array
+/// @file glm/gtx/intersect_array.inl
+
+#include "../simd/intersect.h"
+#include <cmath>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// One lane of the glm/simd/intersect.h kernels, in the same order of
+	// operations, for pure builds and the primitives past the last packet.
+	// Misses are +infinity.
+	GLM_FUNC_QUALIFIER float nearestSegmentLane(vec2 const& p, float ax, float ay, float bx, float by)
+	{
+		float const abx = bx - ax;
+		float const aby = by - ay;
+		float const apx = p.x - ax;
+		float const apy = p.y - ay;
+
+		// Like _mm_max_ps, 0 / 0 becomes 0
+		float t = (apx * abx + apy * aby) / (abx * abx + aby * aby);
+		t = t > 0.0f ? t : 0.0f;
+		t = t < 1.0f ? t : 1.0f;
+
+		float const dx = apx - t * abx;
+		float const dy = apy - t * aby;
+		return dx * dx + dy * dy;
+	}
+
+	GLM_FUNC_QUALIFIER float nearestCircleLane(vec2 const& p, float cx, float cy, float radius)
+	{
+		float const dx = p.x - cx;
+		float const dy = p.y - cy;
+		float const d2 = dx * dx + dy * dy;
+		return d2 <= radius * radius ? d2 : std::numeric_limits<float>::infinity();
+	}
+
+	GLM_FUNC_QUALIFIER float nearestArcLane(vec2 const& p, float cx, float cy, float inner, float outer, float dirX, float dirY, float cosHalf)
+	{
+		float const dx = p.x - cx;
+		float const dy = p.y - cy;
+		float const d2 = dx * dx + dy * dy;
+		bool const cone = dx * dirX + dy * dirY >= std::sqrt(d2) * cosHalf;
+		bool const ring = d2 >= inner * inner && d2 <= outer * outer;
+		return ring && cone ? d2 : std::numeric_limits<float>::infinity();
+	}
+
+	GLM_FUNC_QUALIFIER float intersectRayTriangleLane(vec3 const& o, vec3 const& d, float const* const v0[3], float const* const v1[3], float const* const v2[3], std::size_t i, vec2& baryPosition)
+	{
+		float const e1x = v1[0][i] - v0[0][i];
+		float const e1y = v1[1][i] - v0[1][i];
+		float const e1z = v1[2][i] - v0[2][i];
+		float const e2x = v2[0][i] - v0[0][i];
+		float const e2y = v2[1][i] - v0[1][i];
+		float const e2z = v2[2][i] - v0[2][i];
+
+		float const pvx = d.y * e2z - d.z * e2y;
+		float const pvy = d.z * e2x - d.x * e2z;
+		float const pvz = d.x * e2y - d.y * e2x;
+		float const det = (e1x * pvx + e1y * pvy) + e1z * pvz;
+		float const rcp = 1.0f / det;
+
+		float const tvx = o.x - v0[0][i];
+		float const tvy = o.y - v0[1][i];
+		float const tvz = o.z - v0[2][i];
+		float const u = ((tvx * pvx + tvy * pvy) + tvz * pvz) * rcp;
+
+		float const qvx = tvy * e1z - tvz * e1y;
+		float const qvy = tvz * e1x - tvx * e1z;
+		float const qvz = tvx * e1y - tvy * e1x;
+		float const v = ((d.x * qvx + d.y * qvy) + d.z * qvz) * rcp;
+		float const t = ((e2x * qvx + e2y * qvy) + e2z * qvz) * rcp;
+
+		baryPosition = vec2(u, v);
+		bool const hit = std::abs(det) > std::numeric_limits<float>::epsilon() && u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t >= 0.0f;
+		return hit ? t : std::numeric_limits<float>::infinity();
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER bool nearestSegment
+	(
+		vec2 const& point,
+		float const* const a[2], float const* const b[2], std::size_t count,
+		float maxDistance, std::size_t& index, float& distance
+	)
+	{
+		float best = maxDistance * maxDistance;
+		std::size_t found = count;
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			i = glm_nearest_segment(point.x, point.y, a[0], a[1], b[0], b[1], count, &best, &found);
+#		endif
+		for(; i < count; ++i)
+		{
+			float const d2 = detail::nearestSegmentLane(point, a[0][i], a[1][i], b[0][i], b[1][i]);
+			if(d2 < best)
+			{
+				best = d2;
+				found = i;
+			}
+		}
+
+		if(found == count)
+			return false;
+		index = found;
+		distance = std::sqrt(best);
+		return true;
+	}
+
+	GLM_FUNC_QUALIFIER bool nearestCircle
+	(
+		vec2 const& point,
+		float const* const center[2], float const* radius, std::size_t count,
+		std::size_t& index, float& distance
+	)
+	{
+		float best = std::numeric_limits<float>::infinity();
+		std::size_t found = count;
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			i = glm_nearest_circle(point.x, point.y, center[0], center[1], radius, count, &best, &found);
+#		endif
+		for(; i < count; ++i)
+		{
+			float const d2 = detail::nearestCircleLane(point, center[0][i], center[1][i], radius[i]);
+			if(d2 < best)
+			{
+				best = d2;
+				found = i;
+			}
+		}
+
+		if(found == count)
+			return false;
+		index = found;
+		distance = std::sqrt(best);
+		return true;
+	}
+
+	GLM_FUNC_QUALIFIER bool nearestArc
+	(
+		vec2 const& point,
+		float const* const center[2], float const* innerRadius, float const* outerRadius,
+		float const* const direction[2], float const* cosHalfAngle, std::size_t count,
+		std::size_t& index, float& distance
+	)
+	{
+		float best = std::numeric_limits<float>::infinity();
+		std::size_t found = count;
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			i = glm_nearest_arc(point.x, point.y, center[0], center[1], innerRadius, outerRadius, direction[0], direction[1], cosHalfAngle, count, &best, &found);
+#		endif
+		for(; i < count; ++i)
+		{
+			float const d2 = detail::nearestArcLane(point, center[0][i], center[1][i], innerRadius[i], outerRadius[i], direction[0][i], direction[1][i], cosHalfAngle[i]);
+			if(d2 < best)
+			{
+				best = d2;
+				found = i;
+			}
+		}
+
+		if(found == count)
+			return false;
+		index = found;
+		distance = std::sqrt(best);
+		return true;
+	}
+
+	GLM_FUNC_QUALIFIER bool intersectRayTriangles
+	(
+		vec3 const& orig, vec3 const& dir,
+		float const* const v0[3], float const* const v1[3], float const* const v2[3], std::size_t count,
+		std::size_t& index, vec2& baryPosition, float& distance
+	)
+	{
+		float best = std::numeric_limits<float>::infinity();
+		std::size_t found = count;
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			i = glm_nearest_ray_triangle(&orig.x, &dir.x, v0, v1, v2, count, &best, &found);
+#		endif
+		vec2 bary;
+		for(; i < count; ++i)
+		{
+			float const t = detail::intersectRayTriangleLane(orig, dir, v0, v1, v2, i, bary);
+			if(t < best)
+			{
+				best = t;
+				found = i;
+			}
+		}
+
+		if(found == count)
+			return false;
+		// The kernels only keep the distance, the barycentric position
+		// comes from testing the nearest triangle again.
+		index = found;
+		distance = detail::intersectRayTriangleLane(orig, dir, v0, v1, v2, found, baryPosition);
+		return true;
+	}
+}//namespace glm
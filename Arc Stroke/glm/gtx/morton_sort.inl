@@ -0,0 +1,178 @@
+/// @ref gtx_morton_sort
+/// @file glm/gtx/morton_sort.inl
+
+#include "../simd/integer.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	include <thread>
+#endif
+
+namespace glm{
+namespace detail
+{
+	// 11 bit digits: three passes cover a 32 bit key and the histogram of
+	// each thread fits in L1.
+	static unsigned const radixBits = 11;
+	static std::size_t const radixBuckets = static_cast<std::size_t>(1) << radixBits;
+	// Fewest keys worth a thread of their own
+	static std::size_t const radixMinPerThread = static_cast<std::size_t>(1) << 16;
+
+	// One pass of the sort over the share of keys of one thread: counting
+	// its digits into offsets, or moving its keys to the offsets found.
+	struct radixPass
+	{
+		uint32 const* keysIn;
+		uint32 const* valuesIn;
+		uint32* keysOut;
+		uint32* valuesOut;
+		std::size_t count;
+		std::size_t share;
+		unsigned shift;
+		std::size_t* offsets;
+		bool scatter;
+
+		void operator()(unsigned task) const
+		{
+			std::size_t const first = std::min(count, task * share);
+			std::size_t const last = std::min(count, first + share);
+			uint32 const mask = static_cast<uint32>(radixBuckets - 1);
+			std::size_t* offset = offsets + task * radixBuckets;
+
+			if(!scatter)
+			{
+				std::fill(offset, offset + radixBuckets, static_cast<std::size_t>(0));
+				for(std::size_t i = first; i < last; ++i)
+					++offset[(keysIn[i] >> shift) & mask];
+				return;
+			}
+
+			for(std::size_t i = first; i < last; ++i)
+			{
+				std::size_t const j = offset[(keysIn[i] >> shift) & mask]++;
+				keysOut[j] = keysIn[i];
+				if(valuesIn)
+					valuesOut[j] = valuesIn[i];
+			}
+		}
+	};
+
+	// pass(0) to pass(tasks - 1), each on its own thread but the first,
+	// which runs on the calling one.
+	GLM_FUNC_QUALIFIER void radixRun(radixPass const& pass, unsigned tasks)
+	{
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			std::vector<std::thread> workers;
+			for(unsigned t = 1; t < tasks; ++t)
+				workers.push_back(std::thread(pass, t));
+			pass(0);
+			for(std::size_t t = 0; t < workers.size(); ++t)
+				workers[t].join();
+#		else
+			for(unsigned t = 0; t < tasks; ++t)
+				pass(t);
+#		endif
+	}
+
+	// glm_vec4_quantize16 on one coordinate
+	GLM_FUNC_QUALIFIER uint16 mortonQuantize(float v, float min, float scale)
+	{
+		float q = (v - min) * scale;
+		q = q > 0.0f ? q : 0.0f;
+		q = q < 65535.0f ? q : 65535.0f;
+		return static_cast<uint16>(q);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void mortonEncode
+	(
+		float const* x, float const* y, std::size_t count,
+		vec2 const& boundsMin, vec2 const& boundsMax, uint32* keys
+	)
+	{
+		float const scaleX = 65536.0f / (boundsMax.x - boundsMin.x);
+		float const scaleY = 65536.0f / (boundsMax.y - boundsMin.y);
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_morton2_encode(x, y, count, boundsMin.x, boundsMin.y, scaleX, scaleY, reinterpret_cast<unsigned int*>(keys));
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				keys[i] = bitfieldInterleave(
+					detail::mortonQuantize(x[i], boundsMin.x, scaleX),
+					detail::mortonQuantize(y[i], boundsMin.y, scaleY));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void radixSort(uint32* keys, uint32* values, std::size_t count, unsigned threads)
+	{
+		if(count < 2)
+			return;
+
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			if(threads == 0)
+				threads = std::thread::hardware_concurrency();
+#		endif
+		std::size_t const most = count / detail::radixMinPerThread + 1;
+		unsigned const tasks = static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(threads, most)));
+
+		std::vector<uint32> keysTemp(count);
+		std::vector<uint32> valuesTemp(values ? count : 0);
+		std::vector<std::size_t> offsets(tasks * detail::radixBuckets);
+
+		uint32* keysIn = keys;
+		uint32* valuesIn = values;
+		uint32* keysOut = &keysTemp[0];
+		uint32* valuesOut = values ? &valuesTemp[0] : NULL;
+
+		for(unsigned shift = 0; shift < 32; shift += detail::radixBits)
+		{
+			detail::radixPass pass = {keysIn, valuesIn, keysOut, valuesOut, count, (count + tasks - 1) / tasks, shift, &offsets[0], false};
+			detail::radixRun(pass, tasks);
+
+			// Where each thread puts each digit: digits in order, and for one
+			// digit the threads in order, which keeps the sort stable. When
+			// every key has the same digit the pass would move nothing.
+			bool same = false;
+			std::size_t sum = 0;
+			for(std::size_t d = 0; d < detail::radixBuckets; ++d)
+				for(unsigned t = 0; t < tasks; ++t)
+				{
+					std::size_t const n = offsets[t * detail::radixBuckets + d];
+					same = same || n == count;
+					offsets[t * detail::radixBuckets + d] = sum;
+					sum += n;
+				}
+			if(same)
+				continue;
+
+			pass.scatter = true;
+			detail::radixRun(pass, tasks);
+			std::swap(keysIn, keysOut);
+			std::swap(valuesIn, valuesOut);
+		}
+
+		if(keysIn != keys)
+		{
+			std::memcpy(keys, keysIn, count * sizeof(uint32));
+			if(values)
+				std::memcpy(values, valuesIn, count * sizeof(uint32));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void mortonSort
+	(
+		float const* x, float const* y, std::size_t count,
+		vec2 const& boundsMin, vec2 const& boundsMax, uint32* order, unsigned threads
+	)
+	{
+		if(count == 0)
+			return;
+
+		std::vector<uint32> keys(count);
+		mortonEncode(x, y, count, boundsMin, boundsMax, &keys[0]);
+		for(std::size_t i = 0; i < count; ++i)
+			order[i] = static_cast<uint32>(i);
+		radixSort(&keys[0], order, count, threads);
+	}
+}//namespace glm
@@ -0,0 +1,104 @@
+/// @ref gtx_noise_array
+/// @file glm/gtx/noise_array.inl
+
+#include "../simd/noise.h"
+#include <algorithm>
+#include <vector>
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	include <atomic>
+#	include <thread>
+#endif
+
+namespace glm{
+namespace detail
+{
+	typedef void (*noiseArrayFunc)(float const* x, float const* y, float* out, std::size_t count);
+
+	// Rows handed to a thread at a time
+	static std::size_t const noiseGridBand = 16;
+
+	GLM_FUNC_QUALIFIER void noiseGridRows(noiseArrayFunc noise, float* out, std::size_t width, std::size_t first, std::size_t last, vec2 const& origin, vec2 const& step, float const* xs)
+	{
+		std::vector<float> ys(width);
+		for(std::size_t r = first; r < last; ++r)
+		{
+			std::fill(ys.begin(), ys.end(), origin.y + step.y * static_cast<float>(r));
+			noise(xs, &ys[0], out + r * width, width);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void noiseGrid(noiseArrayFunc noise, float* out, std::size_t width, std::size_t height, vec2 const& origin, vec2 const& step, unsigned threads)
+	{
+		if(width == 0 || height == 0)
+			return;
+
+		std::vector<float> xs(width);
+		for(std::size_t c = 0; c < width; ++c)
+			xs[c] = origin.x + step.x * static_cast<float>(c);
+
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			std::size_t const bands = (height + noiseGridBand - 1) / noiseGridBand;
+			if(threads == 0)
+				threads = std::thread::hardware_concurrency();
+			if(threads > bands)
+				threads = static_cast<unsigned>(bands);
+
+			if(threads > 1)
+			{
+				// Each thread takes the next band until none are left, the
+				// calling thread being one of them.
+				std::atomic<std::size_t> next(0);
+				auto work = [&]()
+				{
+					for(std::size_t b; (b = next++) < bands;)
+						noiseGridRows(noise, out, width, b * noiseGridBand, min(b * noiseGridBand + noiseGridBand, height), origin, step, &xs[0]);
+				};
+
+				std::vector<std::thread> workers;
+				for(unsigned t = 1; t < threads; ++t)
+					workers.push_back(std::thread(work));
+				work();
+				for(std::size_t t = 0; t < workers.size(); ++t)
+					workers[t].join();
+				return;
+			}
+#		else
+			(void)threads;
+#		endif
+
+		noiseGridRows(noise, out, width, 0, height, origin, step, &xs[0]);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void perlin(float const* x, float const* y, float* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_perlin2_array(x, y, out, count);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = perlin(vec2(x[i], y[i]));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void simplex(float const* x, float const* y, float* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_simplex2_array(x, y, out, count);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = simplex(vec2(x[i], y[i]));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void perlinGrid(float* out, std::size_t width, std::size_t height, vec2 const& origin, vec2 const& step, unsigned threads)
+	{
+		void (*noise)(float const*, float const*, float*, std::size_t) = perlin;
+		detail::noiseGrid(noise, out, width, height, origin, step, threads);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexGrid(float* out, std::size_t width, std::size_t height, vec2 const& origin, vec2 const& step, unsigned threads)
+	{
+		void (*noise)(float const*, float const*, float*, std::size_t) = simplex;
+		detail::noiseGrid(noise, out, width, height, origin, step, threads);
+	}
+}//namespace glm
@@ -0,0 +1,115 @@
+/// @ref simd
+/// @file glm/simd/cpu.h
+
+#pragma once
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// GLM_ARCH is fixed when compiling. The functions here find out what the
+// CPU running the program supports, so kernels built for a newer
+// instruction set can be picked at run time. They are compiled with
+// GLM_SIMD_TARGET, which GCC and Clang need to emit AVX outside of -mavx
+// builds. Visual C++ emits any intrinsic as is.
+
+#if GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG)
+#	include <cpuid.h>
+#	include <immintrin.h>
+#	define GLM_SIMD_TARGET(x) __attribute__((target(x)))
+#	define GLM_SIMD_DISPATCH 1
+#elif GLM_COMPILER & GLM_COMPILER_VC
+#	include <intrin.h>
+#	define GLM_SIMD_TARGET(x)
+#	define GLM_SIMD_DISPATCH 1
+#else
+#	define GLM_SIMD_TARGET(x)
+#	define GLM_SIMD_DISPATCH 0
+#endif
+
+#if GLM_SIMD_DISPATCH
+
+GLM_FUNC_QUALIFIER void glm_cpuid(int leaf, int sub, int regs[4])
+{
+#	if GLM_COMPILER & GLM_COMPILER_VC
+		__cpuidex(regs, leaf, sub);
+#	else
+		unsigned int a = 0, b = 0, c = 0, d = 0;
+		__cpuid_count(leaf, sub, a, b, c, d);
+		regs[0] = static_cast<int>(a);
+		regs[1] = static_cast<int>(b);
+		regs[2] = static_cast<int>(c);
+		regs[3] = static_cast<int>(d);
+#	endif
+}
+
+// Register state the OS saves on context switches, XCR0
+GLM_FUNC_QUALIFIER unsigned int glm_xgetbv()
+{
+#	if GLM_COMPILER & GLM_COMPILER_VC
+		return static_cast<unsigned int>(_xgetbv(0));
+#	else
+		unsigned int a = 0, d = 0;
+		__asm__ volatile("xgetbv" : "=a"(a), "=d"(d) : "c"(0));
+		return a;
+#	endif
+}
+
+// The GLM_ARCH value matching the running CPU. Like GLM_FORCE_AVX2 it
+// requires FMA next to AVX2, and AVX-512 means the Skylake subset.
+GLM_FUNC_QUALIFIER int glm_cpu_detect()
+{
+	int regs[4];
+	glm_cpuid(0, 0, regs);
+	int const maxLeaf = regs[0];
+
+	glm_cpuid(1, 0, regs);
+	int const ecx = regs[2];
+	int const edx = regs[3];
+
+	int arch = GLM_ARCH_X86;
+	if(!(edx & (1 << 26)))
+		return arch;
+	arch = GLM_ARCH_SSE2;
+	if(ecx & (1 << 0))
+		arch = GLM_ARCH_SSE3;
+	if((ecx & (1 << 9)) && arch == GLM_ARCH_SSE3)
+		arch = GLM_ARCH_SSSE3;
+	if((ecx & (1 << 19)) && arch == GLM_ARCH_SSSE3)
+		arch = GLM_ARCH_SSE41;
+	if((ecx & (1 << 20)) && arch == GLM_ARCH_SSE41)
+		arch = GLM_ARCH_SSE42;
+
+	// AVX also needs the OS to save the YMM registers
+	bool const osxsave = (ecx & (1 << 27)) != 0;
+	unsigned int const xcr0 = osxsave ? glm_xgetbv() : 0;
+	if(arch != GLM_ARCH_SSE42 || !(ecx & (1 << 28)) || (xcr0 & 0x6) != 0x6)
+		return arch;
+	arch = GLM_ARCH_AVX;
+
+	if(maxLeaf < 7)
+		return arch;
+	glm_cpuid(7, 0, regs);
+	unsigned int const ebx7 = static_cast<unsigned int>(regs[1]);
+
+	bool const fma = (ecx & (1 << 12)) != 0;
+	if(!fma || !(ebx7 & (1u << 5)))
+		return arch;
+	arch = GLM_ARCH_AVX2;
+
+	// F, DQ, CD, BW and VL, with the opmask and ZMM state enabled
+	unsigned int const avx512 = (1u << 16) | (1u << 17) | (1u << 28) | (1u << 30) | (1u << 31);
+	if((ebx7 & avx512) == avx512 && (xcr0 & 0xe6) == 0xe6)
+		arch = GLM_ARCH_AVX512;
+
+	return arch;
+}
+
+// glm_cpu_detect(), run once
+GLM_FUNC_QUALIFIER int glm_cpu_arch()
+{
+	static int const Arch = glm_cpu_detect();
+	return Arch;
+}
+
+#endif//GLM_SIMD_DISPATCH
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,383 @@
+/// @ref simd
+/// @file glm/simd/noise.h
+
+#pragma once
+
+#include "common.h"
+#include "cpu.h"
+#include <cstddef>
+#include <cstring>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// The 2D noise functions of gtc_noise on 4 points at a time, one point per
+// lane, with the points given as separate x and y registers. The
+// permutation polynomial hashes and the gradients are plain arithmetic,
+// so every lane runs the same instructions and nothing is looked up. Each
+// lane follows the scalar gtc_noise and detail:: code operation for
+// operation, so the results are the same bits.
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_permute(glm_vec4 x)
+{
+	glm_vec4 const mod0 = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(34.0f)), _mm_set1_ps(1.0f)), x);
+	return _mm_sub_ps(mod0, _mm_mul_ps(glm_vec4_floor(_mm_mul_ps(mod0, _mm_set1_ps(1.0f / 289.0f))), _mm_set1_ps(289.0f)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_taylor_inv_sqrt(glm_vec4 r)
+{
+	return _mm_sub_ps(_mm_set1_ps(static_cast<float>(1.79284291400159)), _mm_mul_ps(_mm_set1_ps(static_cast<float>(0.85373472095314)), r));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fade(glm_vec4 t)
+{
+	return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f)));
+}
+
+// Gradient of hash h dotted with the offset (fx, fy) from its corner
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_perlin_grad(glm_vec4 h, glm_vec4 fx, glm_vec4 fy)
+{
+	glm_vec4 const gx0 = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.0f), glm_vec4_fract(_mm_div_ps(h, _mm_set1_ps(41.0f)))), _mm_set1_ps(1.0f));
+	glm_vec4 const gy0 = _mm_sub_ps(glm_vec4_abs(gx0), _mm_set1_ps(0.5f));
+	glm_vec4 const gx1 = _mm_sub_ps(gx0, glm_vec4_floor(_mm_add_ps(gx0, _mm_set1_ps(0.5f))));
+	glm_vec4 const norm = glm_vec4_taylor_inv_sqrt(_mm_add_ps(_mm_mul_ps(gx1, gx1), _mm_mul_ps(gy0, gy0)));
+	return _mm_add_ps(_mm_mul_ps(_mm_mul_ps(gx1, norm), fx), _mm_mul_ps(_mm_mul_ps(gy0, norm), fy));
+}
+
+// Classic Perlin noise, perlin(vec2(x, y))
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_perlin(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const c289 = _mm_set1_ps(289.0f);
+
+	glm_vec4 const floorX = glm_vec4_floor(x);
+	glm_vec4 const floorY = glm_vec4_floor(y);
+
+	// Corner cells, wrapped to 289: x0, x1 = x0 + 1, y0, y1
+	glm_vec4 const ix0 = glm_vec4_mod(floorX, c289);
+	glm_vec4 const ix1 = glm_vec4_mod(_mm_add_ps(floorX, one), c289);
+	glm_vec4 const iy0 = glm_vec4_mod(floorY, c289);
+	glm_vec4 const iy1 = glm_vec4_mod(_mm_add_ps(floorY, one), c289);
+
+	// Offsets from the corners
+	glm_vec4 const fx0 = _mm_sub_ps(x, floorX);
+	glm_vec4 const fy0 = _mm_sub_ps(y, floorY);
+	glm_vec4 const fx1 = _mm_sub_ps(fx0, one);
+	glm_vec4 const fy1 = _mm_sub_ps(fy0, one);
+
+	// Gradient hashes of the corners 00, 10, 01 and 11
+	glm_vec4 const px0 = glm_vec4_permute(ix0);
+	glm_vec4 const px1 = glm_vec4_permute(ix1);
+	glm_vec4 const h00 = glm_vec4_permute(_mm_add_ps(px0, iy0));
+	glm_vec4 const h10 = glm_vec4_permute(_mm_add_ps(px1, iy0));
+	glm_vec4 const h01 = glm_vec4_permute(_mm_add_ps(px0, iy1));
+	glm_vec4 const h11 = glm_vec4_permute(_mm_add_ps(px1, iy1));
+
+	glm_vec4 const n00 = glm_vec4_perlin_grad(h00, fx0, fy0);
+	glm_vec4 const n10 = glm_vec4_perlin_grad(h10, fx1, fy0);
+	glm_vec4 const n01 = glm_vec4_perlin_grad(h01, fx0, fy1);
+	glm_vec4 const n11 = glm_vec4_perlin_grad(h11, fx1, fy1);
+
+	glm_vec4 const fadeX = glm_vec4_fade(fx0);
+	glm_vec4 const fadeY = glm_vec4_fade(fy0);
+	glm_vec4 const nx0 = _mm_add_ps(n00, _mm_mul_ps(fadeX, _mm_sub_ps(n10, n00)));
+	glm_vec4 const nx1 = _mm_add_ps(n01, _mm_mul_ps(fadeX, _mm_sub_ps(n11, n01)));
+	glm_vec4 const nxy = _mm_add_ps(nx0, _mm_mul_ps(fadeY, _mm_sub_ps(nx1, nx0)));
+	return _mm_mul_ps(_mm_set1_ps(static_cast<float>(2.3)), nxy);
+}
+
+// Contribution of the simplex corner of hash p at offset (cx, cy)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_simplex_corner(glm_vec4 p, glm_vec4 cx, glm_vec4 cy)
+{
+	glm_vec4 const d = _mm_sub_ps(_mm_set1_ps(0.5f), _mm_add_ps(_mm_mul_ps(cx, cx), _mm_mul_ps(cy, cy)));
+	glm_vec4 const m0 = _mm_max_ps(d, _mm_setzero_ps());
+	glm_vec4 const m1 = _mm_mul_ps(m0, m0);
+	glm_vec4 const m2 = _mm_mul_ps(m1, m1);
+
+	// Gradients: 41 points uniformly over a line, mapped onto a diamond
+	glm_vec4 const gx = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.0f), glm_vec4_fract(_mm_mul_ps(p, _mm_set1_ps(static_cast<float>(0.024390243902439))))), _mm_set1_ps(1.0f));
+	glm_vec4 const h = _mm_sub_ps(glm_vec4_abs(gx), _mm_set1_ps(0.5f));
+	glm_vec4 const a0 = _mm_sub_ps(gx, glm_vec4_floor(_mm_add_ps(gx, _mm_set1_ps(0.5f))));
+
+	// Normalise gradients implicitly by scaling m
+	glm_vec4 const m3 = _mm_mul_ps(m2, glm_vec4_taylor_inv_sqrt(_mm_add_ps(_mm_mul_ps(a0, a0), _mm_mul_ps(h, h))));
+	return _mm_mul_ps(m3, _mm_add_ps(_mm_mul_ps(a0, cx), _mm_mul_ps(h, cy)));
+}
+
+// Simplex noise, simplex(vec2(x, y))
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_simplex(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const c289 = _mm_set1_ps(289.0f);
+
+	glm_vec4 const C0 = _mm_set1_ps(static_cast<float>(0.211324865405187));
+	glm_vec4 const C1 = _mm_set1_ps(static_cast<float>(0.366025403784439));
+	glm_vec4 const C2 = _mm_set1_ps(static_cast<float>(-0.577350269189626));
+
+	// First corner
+	glm_vec4 const s = _mm_add_ps(_mm_mul_ps(x, C1), _mm_mul_ps(y, C1));
+	glm_vec4 const ix = glm_vec4_floor(_mm_add_ps(x, s));
+	glm_vec4 const iy = glm_vec4_floor(_mm_add_ps(y, s));
+	glm_vec4 const t = _mm_add_ps(_mm_mul_ps(ix, C0), _mm_mul_ps(iy, C0));
+	glm_vec4 const x0x = _mm_add_ps(_mm_sub_ps(x, ix), t);
+	glm_vec4 const x0y = _mm_add_ps(_mm_sub_ps(y, iy), t);
+
+	// Other corners: i1 is (1, 0) below the diagonal, (0, 1) above
+	glm_vec4 const lower = _mm_cmpgt_ps(x0x, x0y);
+	glm_vec4 const i1x = _mm_and_ps(lower, one);
+	glm_vec4 const i1y = _mm_andnot_ps(lower, one);
+	glm_vec4 const x1x = _mm_sub_ps(_mm_add_ps(x0x, C0), i1x);
+	glm_vec4 const x1y = _mm_sub_ps(_mm_add_ps(x0y, C0), i1y);
+	glm_vec4 const x2x = _mm_add_ps(x0x, C2);
+	glm_vec4 const x2y = _mm_add_ps(x0y, C2);
+
+	// Permutations
+	glm_vec4 const mx = glm_vec4_mod(ix, c289);
+	glm_vec4 const my = glm_vec4_mod(iy, c289);
+	glm_vec4 const p0 = glm_vec4_permute(_mm_add_ps(glm_vec4_permute(my), mx));
+	glm_vec4 const p1 = glm_vec4_permute(_mm_add_ps(_mm_add_ps(glm_vec4_permute(_mm_add_ps(my, i1y)), mx), i1x));
+	glm_vec4 const p2 = glm_vec4_permute(_mm_add_ps(_mm_add_ps(glm_vec4_permute(_mm_add_ps(my, one)), mx), one));
+
+	glm_vec4 const g0 = glm_vec4_simplex_corner(p0, x0x, x0y);
+	glm_vec4 const g1 = glm_vec4_simplex_corner(p1, x1x, x1y);
+	glm_vec4 const g2 = glm_vec4_simplex_corner(p2, x2x, x2y);
+	return _mm_mul_ps(_mm_set1_ps(130.0f), _mm_add_ps(_mm_add_ps(g0, g1), g2));
+}
+
+// perlin or simplex of the count points (x[i], y[i]) into out[i]. The
+// arrays need no alignment. The points past the last full packet run
+// through a zero padded one. glm_perlin2_array and glm_simplex2_array
+// pick the widest version the CPU runs.
+GLM_FUNC_QUALIFIER void glm_perlin2_array_sse(float const* x, float const* y, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+	for(; i + 4 <= count; i += 4)
+		_mm_storeu_ps(out + i, glm_vec4_perlin(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i)));
+	if(i < count)
+	{
+		float px[4] = {0}, py[4] = {0}, po[4];
+		std::memcpy(px, x + i, (count - i) * sizeof(float));
+		std::memcpy(py, y + i, (count - i) * sizeof(float));
+		_mm_storeu_ps(po, glm_vec4_perlin(_mm_loadu_ps(px), _mm_loadu_ps(py)));
+		std::memcpy(out + i, po, (count - i) * sizeof(float));
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_simplex2_array_sse(float const* x, float const* y, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+	for(; i + 4 <= count; i += 4)
+		_mm_storeu_ps(out + i, glm_vec4_simplex(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i)));
+	if(i < count)
+	{
+		float px[4] = {0}, py[4] = {0}, po[4];
+		std::memcpy(px, x + i, (count - i) * sizeof(float));
+		std::memcpy(py, y + i, (count - i) * sizeof(float));
+		_mm_storeu_ps(po, glm_vec4_simplex(_mm_loadu_ps(px), _mm_loadu_ps(py)));
+		std::memcpy(out + i, po, (count - i) * sizeof(float));
+	}
+}
+
+#if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_fract_avx(__m256 x)
+{
+	return _mm256_sub_ps(x, _mm256_floor_ps(x));
+}
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_mod_avx(__m256 x, __m256 y)
+{
+	return _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_floor_ps(_mm256_div_ps(x, y))));
+}
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_abs_avx(__m256 x)
+{
+	return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+}
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_permute_avx(__m256 x)
+{
+	__m256 const mod0 = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(34.0f)), _mm256_set1_ps(1.0f)), x);
+	return _mm256_sub_ps(mod0, _mm256_mul_ps(_mm256_floor_ps(_mm256_mul_ps(mod0, _mm256_set1_ps(1.0f / 289.0f))), _mm256_set1_ps(289.0f)));
+}
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_taylor_inv_sqrt_avx(__m256 r)
+{
+	return _mm256_sub_ps(_mm256_set1_ps(static_cast<float>(1.79284291400159)), _mm256_mul_ps(_mm256_set1_ps(static_cast<float>(0.85373472095314)), r));
+}
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_fade_avx(__m256 t)
+{
+	return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), _mm256_add_ps(_mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f))), _mm256_set1_ps(10.0f)));
+}
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_perlin_grad_avx(__m256 h, __m256 fx, __m256 fy)
+{
+	__m256 const gx0 = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), glm_vec8_fract_avx(_mm256_div_ps(h, _mm256_set1_ps(41.0f)))), _mm256_set1_ps(1.0f));
+	__m256 const gy0 = _mm256_sub_ps(glm_vec8_abs_avx(gx0), _mm256_set1_ps(0.5f));
+	__m256 const gx1 = _mm256_sub_ps(gx0, _mm256_floor_ps(_mm256_add_ps(gx0, _mm256_set1_ps(0.5f))));
+	__m256 const norm = glm_vec8_taylor_inv_sqrt_avx(_mm256_add_ps(_mm256_mul_ps(gx1, gx1), _mm256_mul_ps(gy0, gy0)));
+	return _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(gx1, norm), fx), _mm256_mul_ps(_mm256_mul_ps(gy0, norm), fy));
+}
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_perlin_avx(__m256 x, __m256 y)
+{
+	__m256 const one = _mm256_set1_ps(1.0f);
+	__m256 const c289 = _mm256_set1_ps(289.0f);
+
+	__m256 const floorX = _mm256_floor_ps(x);
+	__m256 const floorY = _mm256_floor_ps(y);
+
+	// Corner cells, wrapped to 289: x0, x1 = x0 + 1, y0, y1
+	__m256 const ix0 = glm_vec8_mod_avx(floorX, c289);
+	__m256 const ix1 = glm_vec8_mod_avx(_mm256_add_ps(floorX, one), c289);
+	__m256 const iy0 = glm_vec8_mod_avx(floorY, c289);
+	__m256 const iy1 = glm_vec8_mod_avx(_mm256_add_ps(floorY, one), c289);
+
+	// Offsets from the corners
+	__m256 const fx0 = _mm256_sub_ps(x, floorX);
+	__m256 const fy0 = _mm256_sub_ps(y, floorY);
+	__m256 const fx1 = _mm256_sub_ps(fx0, one);
+	__m256 const fy1 = _mm256_sub_ps(fy0, one);
+
+	// Gradient hashes of the corners 00, 10, 01 and 11
+	__m256 const px0 = glm_vec8_permute_avx(ix0);
+	__m256 const px1 = glm_vec8_permute_avx(ix1);
+	__m256 const h00 = glm_vec8_permute_avx(_mm256_add_ps(px0, iy0));
+	__m256 const h10 = glm_vec8_permute_avx(_mm256_add_ps(px1, iy0));
+	__m256 const h01 = glm_vec8_permute_avx(_mm256_add_ps(px0, iy1));
+	__m256 const h11 = glm_vec8_permute_avx(_mm256_add_ps(px1, iy1));
+
+	__m256 const n00 = glm_vec8_perlin_grad_avx(h00, fx0, fy0);
+	__m256 const n10 = glm_vec8_perlin_grad_avx(h10, fx1, fy0);
+	__m256 const n01 = glm_vec8_perlin_grad_avx(h01, fx0, fy1);
+	__m256 const n11 = glm_vec8_perlin_grad_avx(h11, fx1, fy1);
+
+	__m256 const fadeX = glm_vec8_fade_avx(fx0);
+	__m256 const fadeY = glm_vec8_fade_avx(fy0);
+	__m256 const nx0 = _mm256_add_ps(n00, _mm256_mul_ps(fadeX, _mm256_sub_ps(n10, n00)));
+	__m256 const nx1 = _mm256_add_ps(n01, _mm256_mul_ps(fadeX, _mm256_sub_ps(n11, n01)));
+	__m256 const nxy = _mm256_add_ps(nx0, _mm256_mul_ps(fadeY, _mm256_sub_ps(nx1, nx0)));
+	return _mm256_mul_ps(_mm256_set1_ps(static_cast<float>(2.3)), nxy);
+}
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_simplex_corner_avx(__m256 p, __m256 cx, __m256 cy)
+{
+	__m256 const d = _mm256_sub_ps(_mm256_set1_ps(0.5f), _mm256_add_ps(_mm256_mul_ps(cx, cx), _mm256_mul_ps(cy, cy)));
+	__m256 const m0 = _mm256_max_ps(d, _mm256_setzero_ps());
+	__m256 const m1 = _mm256_mul_ps(m0, m0);
+	__m256 const m2 = _mm256_mul_ps(m1, m1);
+
+	// Gradients: 41 points uniformly over a line, mapped onto a diamond
+	__m256 const gx = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), glm_vec8_fract_avx(_mm256_mul_ps(p, _mm256_set1_ps(static_cast<float>(0.024390243902439))))), _mm256_set1_ps(1.0f));
+	__m256 const h = _mm256_sub_ps(glm_vec8_abs_avx(gx), _mm256_set1_ps(0.5f));
+	__m256 const a0 = _mm256_sub_ps(gx, _mm256_floor_ps(_mm256_add_ps(gx, _mm256_set1_ps(0.5f))));
+
+	// Normalise gradients implicitly by scaling m
+	__m256 const m3 = _mm256_mul_ps(m2, glm_vec8_taylor_inv_sqrt_avx(_mm256_add_ps(_mm256_mul_ps(a0, a0), _mm256_mul_ps(h, h))));
+	return _mm256_mul_ps(m3, _mm256_add_ps(_mm256_mul_ps(a0, cx), _mm256_mul_ps(h, cy)));
+}
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_simplex_avx(__m256 x, __m256 y)
+{
+	__m256 const one = _mm256_set1_ps(1.0f);
+	__m256 const c289 = _mm256_set1_ps(289.0f);
+
+	__m256 const C0 = _mm256_set1_ps(static_cast<float>(0.211324865405187));
+	__m256 const C1 = _mm256_set1_ps(static_cast<float>(0.366025403784439));
+	__m256 const C2 = _mm256_set1_ps(static_cast<float>(-0.577350269189626));
+
+	// First corner
+	__m256 const s = _mm256_add_ps(_mm256_mul_ps(x, C1), _mm256_mul_ps(y, C1));
+	__m256 const ix = _mm256_floor_ps(_mm256_add_ps(x, s));
+	__m256 const iy = _mm256_floor_ps(_mm256_add_ps(y, s));
+	__m256 const t = _mm256_add_ps(_mm256_mul_ps(ix, C0), _mm256_mul_ps(iy, C0));
+	__m256 const x0x = _mm256_add_ps(_mm256_sub_ps(x, ix), t);
+	__m256 const x0y = _mm256_add_ps(_mm256_sub_ps(y, iy), t);
+
+	// Other corners: i1 is (1, 0) below the diagonal, (0, 1) above
+	__m256 const lower = _mm256_cmp_ps(x0x, x0y, _CMP_GT_OQ);
+	__m256 const i1x = _mm256_and_ps(lower, one);
+	__m256 const i1y = _mm256_andnot_ps(lower, one);
+	__m256 const x1x = _mm256_sub_ps(_mm256_add_ps(x0x, C0), i1x);
+	__m256 const x1y = _mm256_sub_ps(_mm256_add_ps(x0y, C0), i1y);
+	__m256 const x2x = _mm256_add_ps(x0x, C2);
+	__m256 const x2y = _mm256_add_ps(x0y, C2);
+
+	// Permutations
+	__m256 const mx = glm_vec8_mod_avx(ix, c289);
+	__m256 const my = glm_vec8_mod_avx(iy, c289);
+	__m256 const p0 = glm_vec8_permute_avx(_mm256_add_ps(glm_vec8_permute_avx(my), mx));
+	__m256 const p1 = glm_vec8_permute_avx(_mm256_add_ps(_mm256_add_ps(glm_vec8_permute_avx(_mm256_add_ps(my, i1y)), mx), i1x));
+	__m256 const p2 = glm_vec8_permute_avx(_mm256_add_ps(_mm256_add_ps(glm_vec8_permute_avx(_mm256_add_ps(my, one)), mx), one));
+
+	__m256 const g0 = glm_vec8_simplex_corner_avx(p0, x0x, x0y);
+	__m256 const g1 = glm_vec8_simplex_corner_avx(p1, x1x, x1y);
+	__m256 const g2 = glm_vec8_simplex_corner_avx(p2, x2x, x2y);
+	return _mm256_mul_ps(_mm256_set1_ps(130.0f), _mm256_add_ps(_mm256_add_ps(g0, g1), g2));
+}
+
+GLM_SIMD_TARGET("avx") inline void glm_perlin2_array_avx(float const* x, float const* y, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(out + i, glm_vec8_perlin_avx(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+	if(i < count)
+	{
+		float px[8] = {0}, py[8] = {0}, po[8];
+		std::memcpy(px, x + i, (count - i) * sizeof(float));
+		std::memcpy(py, y + i, (count - i) * sizeof(float));
+		_mm256_storeu_ps(po, glm_vec8_perlin_avx(_mm256_loadu_ps(px), _mm256_loadu_ps(py)));
+		std::memcpy(out + i, po, (count - i) * sizeof(float));
+	}
+}
+
+GLM_SIMD_TARGET("avx") inline void glm_simplex2_array_avx(float const* x, float const* y, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(out + i, glm_vec8_simplex_avx(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+	if(i < count)
+	{
+		float px[8] = {0}, py[8] = {0}, po[8];
+		std::memcpy(px, x + i, (count - i) * sizeof(float));
+		std::memcpy(py, y + i, (count - i) * sizeof(float));
+		_mm256_storeu_ps(po, glm_vec8_simplex_avx(_mm256_loadu_ps(px), _mm256_loadu_ps(py)));
+		std::memcpy(out + i, po, (count - i) * sizeof(float));
+	}
+}
+
+#endif//GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+GLM_FUNC_QUALIFIER void glm_perlin2_array(float const* x, float const* y, float* out, std::size_t count)
+{
+#	if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+#		if GLM_SIMD_DISPATCH
+			int const Arch = GLM_ARCH | glm_cpu_arch();
+#		else
+			int const Arch = GLM_ARCH;
+#		endif
+
+		if(Arch & GLM_ARCH_AVX_BIT)
+			glm_perlin2_array_avx(x, y, out, count);
+		else
+#	endif
+			glm_perlin2_array_sse(x, y, out, count);
+}
+
+GLM_FUNC_QUALIFIER void glm_simplex2_array(float const* x, float const* y, float* out, std::size_t count)
+{
+#	if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+#		if GLM_SIMD_DISPATCH
+			int const Arch = GLM_ARCH | glm_cpu_arch();
+#		else
+			int const Arch = GLM_ARCH;
+#		endif
+
+		if(Arch & GLM_ARCH_AVX_BIT)
+			glm_simplex2_array_avx(x, y, out, count);
+		else
+#	endif
+			glm_simplex2_array_sse(x, y, out, count);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
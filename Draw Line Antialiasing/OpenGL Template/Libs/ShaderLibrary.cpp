@@ -0,0 +1,574 @@
+//
+//  ShaderLibrary.cpp
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+#include <stdio.h>
+#include <map>
+#include <set>
+#include <vector>
+#include <sstream>
+#include <OpenGL/gl3.h>
+
+#include "GLUtil.h"
+#include "ShaderLibrary.h"
+
+// Includes nested deeper than this are taken to be a cycle
+const int MAX_INCLUDE_DEPTH = 16;
+
+const char * TRANSFORM_SHADER = R"SHADER(
+// The rows of a 2D affine transform, see SetTransform()
+uniform vec3 u_transformX;
+uniform vec3 u_transformY;
+
+vec4 transform(vec2 position){
+    vec3 p = vec3(position, 1.0);
+    return vec4(dot(u_transformX, p), dot(u_transformY, p), 0.0, 1.0);
+}
+)SHADER";
+
+const char * STROKE_COVERAGE_SHADER = R"SHADER(
+#if STROKE_AA == AA_FEATHER
+uniform float u_feather;
+#endif
+
+// normal is the interpolated vertex normal, unit length on the outline.
+float strokeCoverage(vec2 normal, float lineWidth){
+    float dist = length(normal) * lineWidth;
+#if STROKE_AA == AA_FEATHER
+    return dist < lineWidth - u_feather - u_feather? 1.0 :clamp(((lineWidth - dist) / u_feather / 2.0) , 0.0, 1.0);
+#else
+    return dist < lineWidth ? 1.0 : 0.0;
+#endif
+}
+)SHADER";
+
+const char * STROKE_JOIN_SHADER = R"SHADER(
+// Unit normal of the segment from a to b, to its left
+vec2 segmentNormal(vec2 a, vec2 b){
+    vec2 d = normalize(b - a);
+    return vec2(-d.y, d.x);
+}
+
+// Offset of the outline where a segment with normal n1 meets one with n2
+vec2 miterVector(vec2 n1, vec2 n2, float halfWidth){
+    vec2 joinNormal = n1 + n2;
+    return joinNormal * (halfWidth / dot(n2, joinNormal));
+}
+
+// How far p lies on the side of the segment with direction d1 of the line
+// through the joint that splits the join with the next direction d2, the
+// line the miter follows. Each pixel of a round join is on one side only,
+// so the two segments drawing it cover it once. A line turning straight
+// back has no such line and gets 1.0, nothing clipped.
+float joinSide(vec2 p, vec2 joint, vec2 d1, vec2 d2){
+    vec2 tangent = d1 + d2;
+    if (dot(tangent, tangent) < 1e-8) {
+        return 1.0;
+    }
+    return dot(joint - p, normalize(tangent));
+}
+)SHADER";
+
+const char * STROKE_VERTEX_SHADER = R"SHADER(
+#version 330 core
+
+#include "transform.glsl"
+#include "stroke_join.glsl"
+
+uniform float u_lineWidth;
+
+out vec2 vNormal;
+
+#if STROKE_INSTANCED
+#if STROKE_PULLED
+// The points of the line once each in a texture buffer. Every segment
+// draws u_corners vertices and fetches its own points, the indices
+// clamped to the line, so a_Prev == a_Start marks the start of the line.
+uniform samplerBuffer u_points;
+uniform int u_pointCount;
+uniform int u_corners;
+
+vec2 a_Prev;
+vec2 a_Start;
+vec2 a_End;
+vec2 a_Next;
+
+int pullSegment(){
+    int segment = gl_VertexID / u_corners;
+    int last = u_pointCount - 1;
+    a_Prev = texelFetch(u_points, max(segment - 1, 0)).xy;
+    a_Start = texelFetch(u_points, segment).xy;
+    a_End = texelFetch(u_points, min(segment + 1, last)).xy;
+    a_Next = texelFetch(u_points, min(segment + 2, last)).xy;
+    return gl_VertexID - segment * u_corners;
+}
+#else
+// One instance per segment. The end points are repeated at both ends of
+// the point buffer, so a_Prev == a_Start marks the start of the line.
+in vec2 a_Prev;
+in vec2 a_Start;
+in vec2 a_End;
+in vec2 a_Next;
+#endif
+
+out float vAlong;
+flat out float vLength;
+flat out vec2 vRound;
+// joinSide() of the start and end joint, 1.0 at caps
+out vec2 vJoinSide;
+
+#if STROKE_FEEDBACK
+// The position before the transform, for transform feedback to capture
+// with the outputs above, see CapturedStrokeVertex
+out vec2 vScreenPosition;
+#endif
+
+// Same corner order as strokeSegments(): startUp, startDown, endDown,
+// endDown, endUp, startUp. Corners 6-8 are the bevel at the end joint.
+const float cornerEnd[6] = float[6](0.0, 0.0, 1.0, 1.0, 1.0, 0.0);
+const float cornerSide[6] = float[6](1.0, -1.0, -1.0, -1.0, 1.0, 1.0);
+
+void
+main(){
+#if STROKE_PULLED
+    int corner = pullSegment();
+#else
+    int corner = gl_VertexID;
+#endif
+    float halfWidth = u_lineWidth / 2.0;
+    vec2 dir = normalize(a_End - a_Start);
+    vec2 n = vec2(-dir.y, dir.x);
+    bool startCap = a_Prev == a_Start;
+    bool endCap = a_Next == a_End;
+
+    // Caps other than butt and round joins reach half the width past the
+    // end point, the fragment shader rounds the ends flagged in vRound.
+    float capExtend = float(STROKE_CAP != CAP_BUTT);
+    float roundCap = float(STROKE_CAP == CAP_ROUND);
+    float roundJoin = float(STROKE_JOIN == JOIN_ROUND);
+    vec2 extend = vec2(startCap ? capExtend : roundJoin, endCap ? capExtend : roundJoin) * halfWidth;
+    vRound = vec2(startCap ? roundCap : roundJoin, endCap ? roundCap : roundJoin);
+    vLength = distance(a_Start, a_End);
+
+    vec2 startOffset = n * halfWidth;
+    vec2 endOffset = n * halfWidth;
+#if STROKE_JOIN == JOIN_MITER
+    if (!startCap) {
+        startOffset = miterVector(segmentNormal(a_Prev, a_Start), n, halfWidth);
+    }
+    if (!endCap) {
+        endOffset = miterVector(n, segmentNormal(a_End, a_Next), halfWidth);
+    }
+#endif
+
+    vec2 position;
+    if (corner < 6) {
+        float side = cornerSide[corner];
+        if (cornerEnd[corner] == 0.0) {
+            position = a_Start + startOffset * side - dir * extend.x;
+            vAlong = -extend.x;
+        } else {
+            position = a_End + endOffset * side + dir * extend.y;
+            vAlong = vLength + extend.y;
+        }
+        vNormal = n * side;
+    } else {
+        // Fills the notch between this segment and the next one on the
+        // outer side of the turn.
+        vec2 nextNormal = endCap ? n : segmentNormal(a_End, a_Next);
+        float outer = dot(dir, nextNormal) > 0.0 ? 1.0 : -1.0;
+        vNormal = vec2(0.0);
+        if (corner == 7) {
+            vNormal = n * outer;
+        } else if (corner == 8) {
+            vNormal = nextNormal * outer;
+        }
+        position = a_End + vNormal * halfWidth;
+        vAlong = vLength;
+    }
+    vJoinSide = vec2(startCap ? 1.0 : joinSide(position, a_Start, -dir, -normalize(a_Start - a_Prev)),
+                     endCap ? 1.0 : joinSide(position, a_End, dir, normalize(a_Next - a_End)));
+#if STROKE_FEEDBACK
+    vScreenPosition = position;
+#endif
+#else
+layout(location = 0) in vec4 vPosition;
+in vec2 a_Normal;
+
+#if STROKE_PACKED
+// PackedStrokeVertex: the position in tile steps, which the transform
+// scales back, the normal in snorm8 steps and half the line width
+in float a_HalfWidth;
+
+flat out float vLineWidth;
+#endif
+
+void
+main(){
+    vec2 position = vPosition.xy;
+#if STROKE_PACKED
+    vNormal = max(a_Normal / 127.0, -1.0);
+    vLineWidth = a_HalfWidth * 2.0;
+#else
+    vNormal = a_Normal;
+#endif
+#endif
+
+    gl_Position = transform(position);
+}
+)SHADER";
+
+const char * STROKE_CAPTURED_VERTEX_SHADER = R"SHADER(
+#version 330 core
+
+#include "transform.glsl"
+
+// Vertices the feedback variant of stroke.vert captured, see
+// CapturedStrokeVertex. Only the transform is left to apply.
+in vec2 a_Position;
+in vec2 a_Normal;
+in float a_Along;
+in float a_Length;
+in vec2 a_Round;
+in vec2 a_JoinSide;
+
+out vec2 vNormal;
+out float vAlong;
+flat out float vLength;
+flat out vec2 vRound;
+out vec2 vJoinSide;
+
+void
+main(){
+    vNormal = a_Normal;
+    vAlong = a_Along;
+    vLength = a_Length;
+    vRound = a_Round;
+    vJoinSide = a_JoinSide;
+    gl_Position = transform(a_Position);
+}
+)SHADER";
+
+const char * STROKE_ADJACENCY_VERTEX_SHADER = R"SHADER(
+#version 330 core
+
+// The padded points of the instanced stroke, drawn as
+// GL_LINE_STRIP_ADJACENCY: stroke.geom expands them
+in vec2 a_Point;
+
+out vec2 vPoint;
+
+void
+main(){
+    vPoint = a_Point;
+}
+)SHADER";
+
+const char * STROKE_GEOMETRY_SHADER = R"SHADER(
+#version 330 core
+
+#include "transform.glsl"
+#include "stroke_join.glsl"
+
+// One segment with its neighbours: previous, start, end and next point.
+// The end points are repeated, so prev == start marks the start of the line.
+layout(lines_adjacency) in;
+// The quad, then the bevel at the end joint
+layout(triangle_strip, max_vertices = 7) out;
+
+in vec2 vPoint[];
+
+uniform float u_lineWidth;
+
+// The outputs of the instanced stroke.vert, for the same stroke.frag
+out vec2 vNormal;
+out float vAlong;
+flat out float vLength;
+flat out vec2 vRound;
+out vec2 vJoinSide;
+
+float segmentLength;
+vec2 roundEnds;
+vec2 prevPoint, startPoint, endPoint, nextPoint;
+
+void emit(vec2 position, vec2 normal, float along){
+    vec2 dir = normalize(endPoint - startPoint);
+    vNormal = normal;
+    vAlong = along;
+    vLength = segmentLength;
+    vRound = roundEnds;
+    vJoinSide = vec2(prevPoint == startPoint ? 1.0 : joinSide(position, startPoint, -dir, -normalize(startPoint - prevPoint)),
+                     nextPoint == endPoint ? 1.0 : joinSide(position, endPoint, dir, normalize(nextPoint - endPoint)));
+    gl_Position = transform(position);
+    EmitVertex();
+}
+
+void
+main(){
+    vec2 prev = vPoint[0];
+    vec2 start = vPoint[1];
+    vec2 end = vPoint[2];
+    vec2 next = vPoint[3];
+    prevPoint = prev;
+    startPoint = start;
+    endPoint = end;
+    nextPoint = next;
+
+    float halfWidth = u_lineWidth / 2.0;
+    vec2 dir = normalize(end - start);
+    vec2 n = vec2(-dir.y, dir.x);
+    bool startCap = prev == start;
+    bool endCap = next == end;
+
+    // Caps and round joins as in stroke.vert
+    float capExtend = float(STROKE_CAP != CAP_BUTT);
+    float roundCap = float(STROKE_CAP == CAP_ROUND);
+    float roundJoin = float(STROKE_JOIN == JOIN_ROUND);
+    vec2 extend = vec2(startCap ? capExtend : roundJoin, endCap ? capExtend : roundJoin) * halfWidth;
+    roundEnds = vec2(startCap ? roundCap : roundJoin, endCap ? roundCap : roundJoin);
+    segmentLength = distance(start, end);
+
+    vec2 startOffset = n * halfWidth;
+    vec2 endOffset = n * halfWidth;
+#if STROKE_JOIN == JOIN_MITER
+    if (!startCap) {
+        startOffset = miterVector(segmentNormal(prev, start), n, halfWidth);
+    }
+    if (!endCap) {
+        endOffset = miterVector(n, segmentNormal(end, next), halfWidth);
+    }
+#endif
+
+    // Split along the same diagonal as the two triangles of stroke.vert
+    emit(start - startOffset - dir * extend.x, -n, -extend.x);
+    emit(start + startOffset - dir * extend.x, n, -extend.x);
+    emit(end - endOffset + dir * extend.y, -n, segmentLength + extend.y);
+    emit(end + endOffset + dir * extend.y, n, segmentLength + extend.y);
+    EndPrimitive();
+
+#if STROKE_JOIN == JOIN_BEVEL
+    // Fills the notch between this segment and the next one on the outer
+    // side of the turn.
+    if (!endCap) {
+        vec2 nextNormal = segmentNormal(end, next);
+        float outer = dot(dir, nextNormal) > 0.0 ? 1.0 : -1.0;
+        emit(end, vec2(0.0), segmentLength);
+        emit(end + n * outer * halfWidth, n * outer, segmentLength);
+        emit(end + nextNormal * outer * halfWidth, nextNormal * outer, segmentLength);
+        EndPrimitive();
+    }
+#endif
+}
+)SHADER";
+
+const char * STROKE_FRAGMENT_SHADER = R"SHADER(
+#version 330 core
+
+#include "stroke_coverage.glsl"
+
+in vec2 vNormal;
+#if STROKE_INSTANCED
+in float vAlong;
+flat in float vLength;
+flat in vec2 vRound;
+in vec2 vJoinSide;
+#elif STROKE_PACKED
+flat in float vLineWidth;
+#endif
+out vec4 fColor;
+
+uniform float u_lineWidth;
+void
+main(){
+#if STROKE_PACKED && !STROKE_INSTANCED
+    float lineWidth = vLineWidth + 0.5;
+#else
+    float lineWidth = u_lineWidth + 0.5;
+#endif
+    vec2 normal = vNormal;
+#if STROKE_INSTANCED
+#if STROKE_JOIN == JOIN_ROUND
+    // Both segments reach around a round join, each keeps its own side
+    if (min(vJoinSide.x, vJoinSide.y) < 0.0) {
+        discard;
+    }
+#endif
+    // Past a rounded end the coverage follows the distance to the end point
+    float past = vAlong < 0.0 ? -vAlong * vRound.x : max(vAlong - vLength, 0.0) * vRound.y;
+    normal = vec2(length(vNormal), past / (u_lineWidth / 2.0));
+#endif
+    fColor = vec4(0.0, 0.0, 0.0, strokeCoverage(normal, lineWidth));
+}
+)SHADER";
+
+static std::map<std::string, std::string> &ShaderSources(){
+    static std::map<std::string, std::string> sources;
+    if (sources.empty()) {
+        sources["transform.glsl"] = TRANSFORM_SHADER;
+        sources["stroke_coverage.glsl"] = STROKE_COVERAGE_SHADER;
+        sources["stroke_join.glsl"] = STROKE_JOIN_SHADER;
+        sources["stroke.vert"] = STROKE_VERTEX_SHADER;
+        sources["stroke_captured.vert"] = STROKE_CAPTURED_VERTEX_SHADER;
+        sources["stroke_adjacency.vert"] = STROKE_ADJACENCY_VERTEX_SHADER;
+        sources["stroke.geom"] = STROKE_GEOMETRY_SHADER;
+        sources["stroke.frag"] = STROKE_FRAGMENT_SHADER;
+    }
+    return sources;
+}
+
+// A program GetShaderProgram() linked, with every source that went into
+// it, includes too
+struct CachedProgram {
+    GLuint program;
+    std::set<std::string> sources;
+};
+
+static std::map<std::string, CachedProgram> &ShaderPrograms(){
+    static std::map<std::string, CachedProgram> programs;
+    return programs;
+}
+
+void RegisterShaderSource(std::string name, std::string shaderCode){
+    ShaderSources()[name] = shaderCode;
+
+    // Programs built from the old source are stale
+    std::map<std::string, CachedProgram> &programs = ShaderPrograms();
+    for (std::map<std::string, CachedProgram>::iterator it = programs.begin(); it != programs.end(); ) {
+        if (it->second.sources.count(name)) {
+            glDeleteProgram(it->second.program);
+            programs.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+}
+
+static std::string ResolveIncludes(const std::string &shaderCode, std::set<std::string> &included, int depth){
+    std::istringstream input(shaderCode);
+    std::string output;
+    std::string line;
+
+    while (std::getline(input, line)) {
+        size_t start = line.find_first_not_of(" \t");
+        if (start == std::string::npos || line.compare(start, 8, "#include") != 0) {
+            output += line + "\n";
+            continue;
+        }
+
+        size_t open = line.find('"', start);
+        size_t close = open == std::string::npos ? open : line.find('"', open + 1);
+        if (close == std::string::npos) {
+            printf("Malformed shader include: %s\n", line.c_str());
+            continue;
+        }
+
+        std::string name = line.substr(open + 1, close - open - 1);
+        if (included.count(name)) {
+            continue;
+        }
+        if (depth >= MAX_INCLUDE_DEPTH) {
+            printf("Shader includes nested too deep at \"%s\"\n", name.c_str());
+            continue;
+        }
+
+        std::map<std::string, std::string>::iterator source = ShaderSources().find(name);
+        if (source == ShaderSources().end()) {
+            printf("Shader include \"%s\" is not registered\n", name.c_str());
+            continue;
+        }
+
+        included.insert(name);
+        output += ResolveIncludes(source->second, included, depth + 1);
+    }
+
+    return output;
+}
+
+std::string ResolveShaderIncludes(std::string shaderCode){
+    std::set<std::string> included;
+    return ResolveIncludes(shaderCode, included, 0);
+}
+
+unsigned ShaderKey::bits() const {
+    return (unsigned)cap | ((unsigned)join << 2) | ((unsigned)aa << 4) | ((unsigned)instanced << 5) | ((unsigned)packed << 6) | ((unsigned)pulled << 7) | ((unsigned)!feedback.empty() << 8);
+}
+
+std::string ShaderKey::defines() const {
+    char buffer[512];
+    snprintf(buffer, sizeof(buffer),
+             "#define CAP_BUTT %d\n#define CAP_SQUARE %d\n#define CAP_ROUND %d\n"
+             "#define JOIN_MITER %d\n#define JOIN_BEVEL %d\n#define JOIN_ROUND %d\n"
+             "#define AA_NONE %d\n#define AA_FEATHER %d\n"
+             "#define STROKE_CAP %d\n#define STROKE_JOIN %d\n#define STROKE_AA %d\n#define STROKE_INSTANCED %d\n#define STROKE_PACKED %d\n#define STROKE_PULLED %d\n#define STROKE_FEEDBACK %d",
+             CAP_BUTT, CAP_SQUARE, CAP_ROUND,
+             JOIN_MITER, JOIN_BEVEL, JOIN_ROUND,
+             AA_NONE, AA_FEATHER,
+             cap, join, aa, instanced ? 1 : 0, packed ? 1 : 0, pulled ? 1 : 0, feedback.empty() ? 0 : 1);
+    return buffer;
+}
+
+GLuint GetShaderProgram(std::string vertexName, std::string fragmentName, ShaderKey key){
+    return GetShaderProgram(vertexName, "", fragmentName, key);
+}
+
+GLuint GetShaderProgram(std::string vertexName, std::string geometryName, std::string fragmentName, ShaderKey key){
+    std::map<std::string, CachedProgram> &programs = ShaderPrograms();
+
+    char bits[16];
+    snprintf(bits, sizeof(bits), "%u", key.bits());
+    std::string name = vertexName + "|" + geometryName + "|" + fragmentName + "|" + bits;
+    for (size_t i = 0; i < key.feedback.size(); i++) {
+        name += (i == 0 ? "|" : ",") + key.feedback[i];
+    }
+
+    std::map<std::string, CachedProgram>::iterator found = programs.find(name);
+    if (found != programs.end()) {
+        return found->second.program;
+    }
+
+    std::map<std::string, std::string>::iterator vertexSource = ShaderSources().find(vertexName);
+    std::map<std::string, std::string>::iterator geometrySource = ShaderSources().find(geometryName);
+    std::map<std::string, std::string>::iterator fragmentSource = ShaderSources().find(fragmentName);
+    if (vertexSource == ShaderSources().end() || fragmentSource == ShaderSources().end() ||
+        (!geometryName.empty() && geometrySource == ShaderSources().end())) {
+        printf("Shader \"%s\", \"%s\" or \"%s\" is not registered\n", vertexName.c_str(), geometryName.c_str(), fragmentName.c_str());
+        return 0;
+    }
+
+    // Each stage resolves its own includes, all of them are remembered
+    CachedProgram cached;
+    std::set<std::string> included;
+    std::string vertexCode = ResolveIncludes(vertexSource->second, included, 0);
+    cached.sources.insert(included.begin(), included.end());
+    included.clear();
+    std::string fragmentCode = ResolveIncludes(fragmentSource->second, included, 0);
+    cached.sources.insert(included.begin(), included.end());
+    std::string geometryCode;
+    if (!geometryName.empty()) {
+        included.clear();
+        geometryCode = ResolveIncludes(geometrySource->second, included, 0);
+        cached.sources.insert(included.begin(), included.end());
+        cached.sources.insert(geometryName);
+    }
+    cached.sources.insert(vertexName);
+    cached.sources.insert(fragmentName);
+
+    cached.program = LoadShadersCached(vertexCode, fragmentCode, key.defines(), DefaultShaderCacheDir(), geometryCode, key.feedback);
+    programs[name] = cached;
+    return cached.program;
+}
+
+std::vector<std::string> CapturedStrokeVaryings(){
+    const char *names[] = { "vScreenPosition", "vNormal", "vAlong", "vLength", "vRound", "vJoinSide" };
+    return std::vector<std::string>(names, names + sizeof(names) / sizeof(names[0]));
+}
+
+void SetTransform(GLuint program, const glm::mat3x2 &transform){
+    GLint rowX = glGetUniformLocation(program, "u_transformX");
+    GLint rowY = glGetUniformLocation(program, "u_transformY");
+    glUniform3f(rowX, transform[0][0], transform[1][0], transform[2][0]);
+    glUniform3f(rowY, transform[0][1], transform[1][1], transform[2][1]);
+}
@@ -0,0 +1,113 @@
+//
+//  ShaderLibrary.h
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+
+#ifndef ShaderLibrary_h
+#define ShaderLibrary_h
+
+#include <string>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <glm/mat3x2.hpp>
+
+// Shader sources are registered by name and can pull each other in with
+// #include "name". A file is only included once per shader, so shared
+// snippets may include their own dependencies. The library comes with:
+//
+//   transform.glsl        2D affine transform() from SetTransform()
+//   stroke_coverage.glsl  feathered coverage across a stroke
+//   stroke_join.glsl      segment normals and miter offsets
+//   stroke.vert           expanded (CPU), instanced or pulled (GPU) stroke
+//                         vertices
+//   stroke_captured.vert  instanced stroke vertices transform feedback
+//                         captured, see CapturedStrokeVertex
+//   stroke_adjacency.vert the points of a GL_LINE_STRIP_ADJACENCY draw
+//   stroke.geom           expands those segments, like the instanced
+//                         stroke.vert, for the instanced stroke.frag
+//
+// Registering a name again replaces its source. Programs GetShaderProgram()
+// built from the old one, directly or through an include, are deleted and
+// built again on the next request.
+void RegisterShaderSource(std::string name, std::string shaderCode);
+
+// Replaces every #include "name" line with the registered source.
+std::string ResolveShaderIncludes(std::string shaderCode);
+
+enum ShaderCap {
+    CAP_BUTT,
+    CAP_SQUARE,
+    CAP_ROUND
+};
+
+enum ShaderJoin {
+    JOIN_MITER,
+    JOIN_BEVEL,
+    JOIN_ROUND
+};
+
+enum ShaderAA {
+    AA_NONE,
+    AA_FEATHER
+};
+
+// Selects one variant of a shader. Shaders see the key as STROKE_CAP,
+// STROKE_JOIN, STROKE_AA, STROKE_INSTANCED, STROKE_PACKED and
+// STROKE_PULLED, next to the CAP_*, JOIN_* and AA_* values to compare them
+// against. packed reads quantized vertices: integer positions the
+// transform scales back, and normals and widths in smaller types, see
+// PackedStrokeVertex. pulled makes the instanced stroke fetch its points
+// from a texture buffer by gl_VertexID instead of instanced attributes.
+// feedback names the outputs transform feedback captures, interleaved in
+// that order. Any makes STROKE_FEEDBACK 1, for the instanced stroke that
+// is CapturedStrokeVaryings().
+struct ShaderKey {
+    ShaderCap cap;
+    ShaderJoin join;
+    ShaderAA aa;
+    bool instanced;
+    bool packed;
+    bool pulled;
+    std::vector<std::string> feedback;
+
+    ShaderKey(ShaderCap cap = CAP_BUTT, ShaderJoin join = JOIN_MITER, ShaderAA aa = AA_FEATHER, bool instanced = false, bool packed = false, bool pulled = false)
+        : cap(cap), join(join), aa(aa), instanced(instanced), packed(packed), pulled(pulled) {}
+
+    // Packs the key into 9 bits, the last one set when feedback names
+    // outputs
+    unsigned bits() const;
+    std::string defines() const;
+};
+
+// One vertex of the instanced stroke as transform feedback captures it
+// from a feedback program, in screen space. stroke_captured.vert draws
+// them again with the instanced stroke.frag.
+struct CapturedStrokeVertex {
+    glm::vec2 position;
+    glm::vec2 normal;
+    float along;
+    float length;
+    glm::vec2 round;
+    glm::vec2 joinSide;
+};
+
+// The outputs of stroke.vert with STROKE_FEEDBACK, in the order of
+// CapturedStrokeVertex
+std::vector<std::string> CapturedStrokeVaryings();
+
+// Returns the program linking the two registered sources for key. A variant
+// is compiled (or loaded from the binary cache) the first time it is asked
+// for, later calls return the same program.
+GLuint GetShaderProgram(std::string vertexName, std::string fragmentName, ShaderKey key = ShaderKey());
+// The same with a geometry stage between the two, none if geometryName is
+// empty
+GLuint GetShaderProgram(std::string vertexName, std::string geometryName, std::string fragmentName, ShaderKey key = ShaderKey());
+
+// Sets the transform() of transform.glsl on the program in use: clip
+// space xy = transform * vec3(position, 1), sent as its two rows.
+void SetTransform(GLuint program, const glm::mat3x2 &transform);
+
+#endif /* ShaderLibrary_h */
@@ -4,6 +4,7 @@
 #include <OpenGL/gl3.h>
 
 #include <stdio.h>
+#include <stddef.h>
 #include <string>
 #include <iostream>
 #include <fstream>
@@ -12,6 +13,7 @@
 #include <errno.h>
 
 #include "GLUtil.h"
+#include "ShaderLibrary.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/vec2.hpp>
@@ -20,11 +22,15 @@
 #include <glm/mat4x4.hpp> // glm::mat4
 #include <glm/gtc/matrix_transform.hpp> // glm::translate, glm::rotate, glm::scale, glm::perspective
 #include <glm/gtc/constants.hpp> // glm::pi
+#include <glm/gtc/packing.hpp> // glm::packSnorm1x16
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/affine_2d.hpp> // glm::affineOrtho
 
 // Vertice shader
 const char * VERTEX_SHADER = R"SHADER(
 #version 330 core
-#define lineWidth (4.0 + 1.0)
+
+#include "transform.glsl"
 
 layout(location = 0) in vec4 vPosition;
 in vec2 a_Normal;
@@ -32,33 +38,47 @@ in vec2 a_Direction;
 
 out vec2 vNormal;
 out vec2 vDirection;
-uniform mat4 modelView;
-uniform mat4 project;
+uniform float u_lineWidth;
+
+#if STROKE_PACKED
+// PackedLineVertex: the position in steps of u_positionStep pixels, the
+// normal and direction in snorm16 steps
+uniform float u_positionStep;
+#endif
 
 void
 main(){
-    vec4 delta = vec4(a_Normal * vec2(lineWidth/2.0), 0, 0);
-    vec4 d = vec4(delta.xy, 0.0, 0.0);
-    vec4 pos = project * modelView * vec4((vPosition.xy + d.xy) / 1.0, 0, 1);
-    gl_Position = pos;
-    vNormal = a_Normal;
-    vDirection = a_Direction;
+#if STROKE_PACKED
+    vec2 position = vPosition.xy * u_positionStep;
+    vec2 normal = max(a_Normal / 32767.0, -1.0);
+    vec2 direction = max(a_Direction / 32767.0, -1.0);
+#else
+    vec2 position = vPosition.xy;
+    vec2 normal = a_Normal;
+    vec2 direction = a_Direction;
+#endif
+    float lineWidth = u_lineWidth + 1.0;
+    vec2 delta = normal * vec2(lineWidth/2.0);
+    gl_Position = transform(position + delta);
+    vNormal = normal;
+    vDirection = direction;
 }
 )SHADER";
 
 // Fragment shader
 const char * FRAGMENT_SHADER = R"SHADER(
 #version 330 core
-#define feather 1.0
-#define lineWidth (4.0 + 0.5)
+
+#include "stroke_coverage.glsl"
 
 in vec2 vNormal;
 in vec2 vDirection;
 out vec4 fColor;
+
+uniform float u_lineWidth;
 void
 main(){
-    float dist = length(vNormal) * lineWidth;
-    float alpha = dist < lineWidth - feather - feather? 1.0 :clamp(((lineWidth - dist) / feather / 2.0) , 0.0, 1.0);
+    float alpha = strokeCoverage(vNormal, u_lineWidth + 0.5);
     float l = length(vDirection);
     if (abs(l - 1.0) < 0.01) {
         alpha = abs(l - 1.0) * 10.0 + 0.2;
@@ -67,15 +87,51 @@ main(){
 }
 )SHADER";
 
+const float lineWidth = 4.0;
+const float feather = 1.0;
 
 //Screen dimension constants
 const int SCREEN_WIDTH = 640;
 
 const int SCREEN_HEIGHT = 480;
 
+// Screen coordinates to clip space, y down. Built at compile time, the
+// corners checked below.
+constexpr glm::mat3x2 SCREEN_TO_CLIP = glm::affineOrtho(0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0.0f);
+static_assert(SCREEN_TO_CLIP[2].x == -1.0f && SCREEN_TO_CLIP[2].y == 1.0f, "top left corner is not (-1, 1)");
+constexpr glm::vec2 SCREEN_BOTTOM_RIGHT = SCREEN_TO_CLIP * glm::vec3(SCREEN_WIDTH, SCREEN_HEIGHT, 1);
+static_assert(SCREEN_BOTTOM_RIGHT.x == 1.0f && SCREEN_BOTTOM_RIGHT.y == -1.0f, "bottom right corner is not (1, -1)");
+#if GLM_ARCH == GLM_ARCH_PURE
+// mat4 and vec4 are only literal types without SIMD. The same transform
+// from ortho, and from translate times scale, must agree with it.
+constexpr glm::mat4 SCREEN_ORTHO = glm::ortho(0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0.0f);
+constexpr glm::mat4 SCREEN_TRANSLATE_SCALE = glm::translate(glm::mat4(1.0f), glm::vec3(-1.0f, 1.0f, 0.0f)) * glm::scale(glm::mat4(1.0f), glm::vec3(2.0f / SCREEN_WIDTH, -2.0f / SCREEN_HEIGHT, 1.0f));
+static_assert(SCREEN_ORTHO[0][0] == SCREEN_TO_CLIP[0][0] && SCREEN_ORTHO[1][1] == SCREEN_TO_CLIP[1][1] && SCREEN_ORTHO[3][0] == SCREEN_TO_CLIP[2][0] && SCREEN_ORTHO[3][1] == SCREEN_TO_CLIP[2][1], "ortho differs from affineOrtho");
+static_assert(SCREEN_TRANSLATE_SCALE[0][0] == SCREEN_ORTHO[0][0] && SCREEN_TRANSLATE_SCALE[1][1] == SCREEN_ORTHO[1][1] && SCREEN_TRANSLATE_SCALE[3][0] == SCREEN_ORTHO[3][0] && SCREEN_TRANSLATE_SCALE[3][1] == SCREEN_ORTHO[3][1], "translate * scale differs from ortho");
+constexpr glm::vec4 SCREEN_ORTHO_BOTTOM_RIGHT = SCREEN_ORTHO * glm::vec4(SCREEN_WIDTH, SCREEN_HEIGHT, 0, 1);
+static_assert(SCREEN_ORTHO_BOTTOM_RIGHT[0] == 1.0f && SCREEN_ORTHO_BOTTOM_RIGHT[1] == -1.0f, "bottom right corner is not (1, -1)");
+#endif
+
 GLuint program;
 GLuint vertexbuffer;
 
+// The same line in 12 byte vertices instead of 24: the position in int16
+// steps of PACKED_POSITION_STEP pixels, which covers the screen, the
+// normal and direction as snorm16. snorm8 would halve them again, but the
+// fragment shader tells the ends apart by a direction length within 0.01
+// of 1, finer than 1/127 steps keep.
+struct PackedLineVertex {
+    GLshort x, y;
+    GLshort nx, ny;
+    GLshort dx, dy;
+};
+
+const float PACKED_POSITION_STEP = 1.0f / 32.0f;
+
+GLuint packedProgram;
+GLuint packedvertexbuffer;
+bool gPacked = false;
+
 glm::vec2 perp(glm::vec2 p) {
     float ty = p[1];
     float y = p[0];
@@ -100,7 +156,10 @@ void initVertices(){
     glBindVertexArray(VertexArrayID);
 
     // Create and compile our GLSL program from the shaders
-    program = LoadShaders(VERTEX_SHADER, FRAGMENT_SHADER);
+    RegisterShaderSource("line.vert", VERTEX_SHADER);
+    RegisterShaderSource("line.frag", FRAGMENT_SHADER);
+    program = GetShaderProgram("line.vert", "line.frag");
+    packedProgram = GetShaderProgram("line.vert", "line.frag", ShaderKey(CAP_BUTT, JOIN_MITER, AA_FEATHER, false, true));
 
     // Line points
     glm::vec2 p1 = glm::vec2(10, 10);
@@ -130,6 +189,21 @@ void initVertices(){
     glBindBuffer(GL_ARRAY_BUFFER, vertexbuffer);
     glBufferData(GL_ARRAY_BUFFER, sizeof(g_vertex_buffer_data), g_vertex_buffer_data, GL_STATIC_DRAW);
 
+    const size_t vertexCount = sizeof(g_vertex_buffer_data) / sizeof(GLfloat) / 6;
+    PackedLineVertex packed[vertexCount];
+    for (size_t i = 0; i < vertexCount; i++) {
+        const GLfloat *v = &g_vertex_buffer_data[i * 6];
+        packed[i].x = (GLshort)glm::round(v[0] / PACKED_POSITION_STEP);
+        packed[i].y = (GLshort)glm::round(v[1] / PACKED_POSITION_STEP);
+        packed[i].nx = (GLshort)glm::packSnorm1x16(v[2]);
+        packed[i].ny = (GLshort)glm::packSnorm1x16(v[3]);
+        packed[i].dx = (GLshort)glm::packSnorm1x16(v[4]);
+        packed[i].dy = (GLshort)glm::packSnorm1x16(v[5]);
+    }
+
+    glGenBuffers(1, &packedvertexbuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, packedvertexbuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(packed), packed, GL_STATIC_DRAW);
 }
 // End Red book
 
@@ -241,12 +315,41 @@ void handleKeys(unsigned char key, int x, int y){
     if(key == 'q'){
         gRender = !gRender;
     }
+    //Toggle packed vertices
+    if(key == 'p'){
+        gPacked = !gPacked;
+        printf("%s vertices\n", gPacked ? "Packed" : "Float");
+    }
 }
 
 void update(){
     //No per frame update needed
 }
 
+// Draws the line from PackedLineVertex, with packedProgram in use. The
+// integer attributes reach the shader unnormalized, it scales them itself.
+void drawPacked(){
+    glUniform1f(glGetUniformLocation(packedProgram, "u_positionStep"), PACKED_POSITION_STEP);
+
+    GLuint positionLocation = glGetAttribLocation(packedProgram, "vPosition");
+    GLuint normalLocation = glGetAttribLocation(packedProgram, "a_Normal");
+    GLuint directionLocation = glGetAttribLocation(packedProgram, "a_Direction");
+    glEnableVertexAttribArray(positionLocation);
+    glEnableVertexAttribArray(normalLocation);
+    glEnableVertexAttribArray(directionLocation);
+
+    glBindBuffer(GL_ARRAY_BUFFER, packedvertexbuffer);
+    glVertexAttribPointer(positionLocation, 2, GL_SHORT, GL_FALSE, sizeof(PackedLineVertex), (void*)offsetof(PackedLineVertex, x));
+    glVertexAttribPointer(normalLocation, 2, GL_SHORT, GL_FALSE, sizeof(PackedLineVertex), (void*)offsetof(PackedLineVertex, nx));
+    glVertexAttribPointer(directionLocation, 2, GL_SHORT, GL_FALSE, sizeof(PackedLineVertex), (void*)offsetof(PackedLineVertex, dx));
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    glDisableVertexAttribArray(positionLocation);
+    glDisableVertexAttribArray(normalLocation);
+    glDisableVertexAttribArray(directionLocation);
+}
+
 void render(){
     if (!gRender) {
         // Clear the screen
@@ -257,18 +360,21 @@ void render(){
     glClear(GL_COLOR_BUFFER_BIT);
 
     // Use our shader
-    glUseProgram(program);
+    GLuint active = gPacked ? packedProgram : program;
+    glUseProgram(active);
 
-    // Ortho matrix
-    glm::mat4 modelView = glm::mat4(1.0f);
-    modelView = glm::translate(modelView, glm::vec3(0.0, 0.0, -1.0f));
-    GLint uniModelView = glGetUniformLocation(program, "modelView");
-    glUniformMatrix4fv(uniModelView, 1, GL_FALSE, glm::value_ptr(modelView));
+    SetTransform(active, SCREEN_TO_CLIP);
 
+    GLint uniLineWidth = glGetUniformLocation(active, "u_lineWidth");
+    glUniform1f(uniLineWidth, lineWidth);
 
-    glm::mat4 ortho = glm::ortho(0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0.0f, 0.1f, 100.0f);
-    GLint uniProj = glGetUniformLocation(program, "project");
-    glUniformMatrix4fv(uniProj, 1, GL_FALSE, glm::value_ptr(ortho));
+    GLint uniFeather = glGetUniformLocation(active, "u_feather");
+    glUniform1f(uniFeather, feather);
+
+    if (gPacked) {
+        drawPacked();
+        return;
+    }
 
     // 1st attribute buffer : vertices
     GLuint VertexPosition_location = glGetAttribLocation(program, "vPosition");
@@ -20,9 +20,9 @@ namespace detail
 		{
 			mat<4, 4, float, Q> Result;
 			glm_mat4_matrixCompMult(
-				*static_cast<glm_vec4 const (*)[4]>(&x[0].data),
-				*static_cast<glm_vec4 const (*)[4]>(&y[0].data),
-				*static_cast<glm_vec4(*)[4]>(&Result[0].data));
+				*reinterpret_cast<glm_vec4 const (*)[4]>(&x[0].data),
+				*reinterpret_cast<glm_vec4 const (*)[4]>(&y[0].data),
+				*reinterpret_cast<glm_vec4(*)[4]>(&Result[0].data));
 			return Result;
 		}
 	};
@@ -34,8 +34,8 @@ namespace detail
 		{
 			mat<4, 4, float, Q> Result;
 			glm_mat4_transpose(
-				*static_cast<glm_vec4 const (*)[4]>(&m[0].data),
-				*static_cast<glm_vec4(*)[4]>(&Result[0].data));
+				*reinterpret_cast<glm_vec4 const (*)[4]>(&m[0].data),
+				*reinterpret_cast<glm_vec4(*)[4]>(&Result[0].data));
 			return Result;
 		}
 	};
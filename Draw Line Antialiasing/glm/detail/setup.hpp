@@ -722,6 +722,16 @@
 #	define GLM_CONSTEXPR_SIMD
 #endif
 
+// Whether x is known when compiling, always the case in a constant
+// expression. Component access uses it to pick the member by name there,
+// which constant expressions need, and to index memory at run time.
+// Without the builtin, components are always picked by name.
+#if GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG)
+#	define GLM_IS_CONSTANT(x) __builtin_constant_p(x)
+#else
+#	define GLM_IS_CONSTANT(x) true
+#endif
+
 #ifdef GLM_FORCE_EXPLICIT_CTOR
 #	define GLM_EXPLICIT explicit
 #else
@@ -15,6 +15,7 @@
 
 // Dependency:
 #include "type_precision.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -721,6 +722,48 @@ namespace glm
 	/// @see int packUint2x16(u32vec2 const& v)
 	GLM_FUNC_DECL u32vec2 unpackUint2x32(uint64 p);
 
+	/// Packs count floats into halves, like packHalf1x16 on each of them.
+	/// Uses SSE2 four values at a time.
+	///
+	/// @see gtc_packing
+	/// @see void unpackHalfArray(uint16 const* p, float* v, std::size_t count)
+	GLM_FUNC_DECL void packHalfArray(float const* v, uint16* p, std::size_t count);
+
+	/// Unpacks count halves, like unpackHalf1x16 on each of them.
+	/// Uses F16C or SSE2 four values at a time.
+	///
+	/// @see gtc_packing
+	/// @see void packHalfArray(float const* v, uint16* p, std::size_t count)
+	GLM_FUNC_DECL void unpackHalfArray(uint16 const* p, float* v, std::size_t count);
+
+	/// Packs count vectors, like packSnorm2x16 on each of them.
+	/// Uses SSE2 four vectors at a time.
+	///
+	/// @see gtc_packing
+	/// @see void unpackSnorm2x16Array(uint32 const* p, vec2* v, std::size_t count)
+	GLM_FUNC_DECL void packSnorm2x16Array(vec2 const* v, uint32* p, std::size_t count);
+
+	/// Unpacks count vectors, like unpackSnorm2x16 on each of them.
+	/// Uses SSE2 four vectors at a time.
+	///
+	/// @see gtc_packing
+	/// @see void packSnorm2x16Array(vec2 const* v, uint32* p, std::size_t count)
+	GLM_FUNC_DECL void unpackSnorm2x16Array(uint32 const* p, vec2* v, std::size_t count);
+
+	/// Packs count vectors, like packUnorm4x8 on each of them.
+	/// Uses SSE2 four vectors at a time.
+	///
+	/// @see gtc_packing
+	/// @see void unpackUnorm4x8Array(uint32 const* p, vec4* v, std::size_t count)
+	GLM_FUNC_DECL void packUnorm4x8Array(vec4 const* v, uint32* p, std::size_t count);
+
+	/// Unpacks count vectors, like unpackUnorm4x8 on each of them.
+	/// Uses SSE2 four vectors at a time.
+	///
+	/// @see gtc_packing
+	/// @see void packUnorm4x8Array(vec4 const* v, uint32* p, std::size_t count)
+	GLM_FUNC_DECL void unpackUnorm4x8Array(uint32 const* p, vec4* v, std::size_t count);
+
 
 	/// @}
 }// namespace glm
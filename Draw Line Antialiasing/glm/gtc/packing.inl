@@ -7,6 +7,7 @@
 #include "../vec3.hpp"
 #include "../vec4.hpp"
 #include "../detail/type_half.hpp"
+#include "../simd/packing.h"
 #include <cstring>
 #include <limits>
 
@@ -934,5 +935,90 @@ namespace detail
 		memcpy(&Unpack, &p, sizeof(Unpack));
 		return Unpack;
 	}
-}//namespace glm
 
+	GLM_FUNC_QUALIFIER void packHalfArray(float const* v, uint16* p, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const simdCount = count & ~std::size_t(3); i < simdCount; i += 4)
+				_mm_storel_epi64(reinterpret_cast<glm_ivec4*>(p + i), glm_vec4_packHalf(_mm_loadu_ps(v + i)));
+#		endif
+		for(; i < count; ++i)
+			p[i] = packHalf1x16(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalfArray(uint16 const* p, float* v, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const simdCount = count & ~std::size_t(3); i < simdCount; i += 4)
+				_mm_storeu_ps(v + i, glm_vec4_unpackHalf(_mm_loadl_epi64(reinterpret_cast<glm_ivec4 const*>(p + i))));
+#		endif
+		for(; i < count; ++i)
+			v[i] = unpackHalf1x16(p[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm2x16Array(vec2 const* v, uint32* p, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const simdCount = count & ~std::size_t(3); i < simdCount; i += 4)
+			{
+				glm_vec4 const v0 = _mm_loadu_ps(&v[i].x);
+				glm_vec4 const v1 = _mm_loadu_ps(&v[i + 2].x);
+				_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(p + i), glm_vec4_packSnorm16(v0, v1));
+			}
+#		endif
+		for(; i < count; ++i)
+			p[i] = packSnorm2x16(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm2x16Array(uint32 const* p, vec2* v, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const simdCount = count & ~std::size_t(3); i < simdCount; i += 4)
+			{
+				glm_ivec4 const p0 = _mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(p + i));
+				_mm_storeu_ps(&v[i].x, glm_vec4_unpackSnorm16(p0));
+				_mm_storeu_ps(&v[i + 2].x, glm_vec4_unpackSnorm16(_mm_unpackhi_epi64(p0, p0)));
+			}
+#		endif
+		for(; i < count; ++i)
+			v[i] = unpackSnorm2x16(p[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x8Array(vec4 const* v, uint32* p, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const simdCount = count & ~std::size_t(3); i < simdCount; i += 4)
+			{
+				glm_vec4 const v0 = _mm_loadu_ps(&v[i].x);
+				glm_vec4 const v1 = _mm_loadu_ps(&v[i + 1].x);
+				glm_vec4 const v2 = _mm_loadu_ps(&v[i + 2].x);
+				glm_vec4 const v3 = _mm_loadu_ps(&v[i + 3].x);
+				_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(p + i), glm_vec4_packUnorm8(v0, v1, v2, v3));
+			}
+#		endif
+		for(; i < count; ++i)
+			p[i] = packUnorm4x8(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x8Array(uint32 const* p, vec4* v, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(std::size_t const simdCount = count & ~std::size_t(3); i < simdCount; i += 4)
+			{
+				glm_ivec4 const p0 = _mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(p + i));
+				_mm_storeu_ps(&v[i].x, glm_vec4_unpackUnorm8(p0));
+				_mm_storeu_ps(&v[i + 1].x, glm_vec4_unpackUnorm8(_mm_srli_si128(p0, 4)));
+				_mm_storeu_ps(&v[i + 2].x, glm_vec4_unpackUnorm8(_mm_srli_si128(p0, 8)));
+				_mm_storeu_ps(&v[i + 3].x, glm_vec4_unpackUnorm8(_mm_srli_si128(p0, 12)));
+			}
+#		endif
+		for(; i < count; ++i)
+			v[i] = unpackUnorm4x8(p[i]);
+	}
+}//namespace glm
@@ -0,0 +1,67 @@
+/// @ref gtx_morton_sort
+/// @file glm/gtx/morton_sort.hpp
+///
+/// @see core (dependence)
+/// @see gtc_bitfield (dependence)
+///
+/// @defgroup gtx_morton_sort GLM_GTX_morton_sort
+/// @ingroup gtx
+///
+/// Include <glm/gtx/morton_sort.hpp> to use the features of this extension.
+///
+/// Z-order (Morton order) of 2D primitives, for batches whose neighbours
+/// in memory are neighbours on screen. The center of each primitive is
+/// quantized to 16 bits per axis within a bounding box and the bits are
+/// interleaved as bitfieldInterleave(uint16, uint16) does, with SSE2 or
+/// AVX2. The keys are then sorted by a least significant digit radix
+/// sort, 11 bits per pass, spread over several threads.
+
+#pragma once
+
+// Dependency:
+#include "../gtc/bitfield.hpp"
+#include "../vec2.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_morton_sort is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_morton_sort extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_morton_sort
+	/// @{
+
+	/// keys[i] = bitfieldInterleave(uint16(qx), uint16(qy)) for count points,
+	/// with qx = (x[i] - boundsMin.x) * 65536 / (boundsMax.x - boundsMin.x)
+	/// clamped to [0, 65535], and qy the same in y. NaN coordinates map to 0.
+	///
+	/// @see gtx_morton_sort
+	GLM_FUNC_DECL void mortonEncode(
+		float const* x, float const* y, std::size_t count,
+		vec2 const& boundsMin, vec2 const& boundsMax, uint32* keys);
+
+	/// Sorts count keys in increasing order, keeping equal keys in their
+	/// order, and moves values[i] along with keys[i]. values may be NULL.
+	/// Each pass is split over threads threads, 0 meaning one per core;
+	/// small arrays and builds without C++11 use the calling thread only.
+	///
+	/// @see gtx_morton_sort
+	GLM_FUNC_DECL void radixSort(uint32* keys, uint32* values, std::size_t count, unsigned threads = 0);
+
+	/// Fills order with the indices of the count points in Z-order: the
+	/// points sorted by their mortonEncode() keys.
+	///
+	/// @see gtx_morton_sort
+	GLM_FUNC_DECL void mortonSort(
+		float const* x, float const* y, std::size_t count,
+		vec2 const& boundsMin, vec2 const& boundsMax, uint32* order, unsigned threads = 0);
+
+	/// @}
+}//namespace glm
+
+#include "morton_sort.inl"
@@ -0,0 +1,66 @@
+/// @ref gtx_noise_array
+/// @file glm/gtx/noise_array.hpp
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+///
+/// @defgroup gtx_noise_array GLM_GTX_noise_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/noise_array.hpp> to use the features of this extension.
+///
+/// 2D perlin and simplex noise over whole arrays of points, for textures
+/// and stroke jitter. Points are stored as a structure of arrays, all x
+/// then all y. With SSE2 the glm/simd/noise.h kernels evaluate 4 points at
+/// a time, 8 when the CPU has AVX, and give the same bits as the
+/// gtc_noise functions unless the compiler contracts multiplies and adds
+/// into FMA. The grid functions fill a 2D grid in bands of rows spread
+/// over several threads.
+
+#pragma once
+
+// Dependency:
+#include "../gtc/noise.hpp"
+#include "../vec2.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_noise_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_noise_array extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_noise_array
+	/// @{
+
+	/// out[i] = perlin(vec2(x[i], y[i])) for count points.
+	///
+	/// @see gtx_noise_array
+	GLM_FUNC_DECL void perlin(float const* x, float const* y, float* out, std::size_t count);
+
+	/// out[i] = simplex(vec2(x[i], y[i])) for count points.
+	///
+	/// @see gtx_noise_array
+	GLM_FUNC_DECL void simplex(float const* x, float const* y, float* out, std::size_t count);
+
+	/// Fills the width x height grid out, row after row, with
+	/// out[r * width + c] = perlin(vec2(origin.x + step.x * c, origin.y + step.y * r)).
+	/// Bands of rows go to threads threads, 0 meaning one per core. Without
+	/// C++11 the grid is filled on the calling thread.
+	///
+	/// @see gtx_noise_array
+	GLM_FUNC_DECL void perlinGrid(float* out, std::size_t width, std::size_t height, vec2 const& origin, vec2 const& step, unsigned threads = 0);
+
+	/// simplex() over a grid, as perlinGrid().
+	///
+	/// @see gtx_noise_array
+	GLM_FUNC_DECL void simplexGrid(float* out, std::size_t width, std::size_t height, vec2 const& origin, vec2 const& step, unsigned threads = 0);
+
+	/// @}
+}//namespace glm
+
+#include "noise_array.inl"
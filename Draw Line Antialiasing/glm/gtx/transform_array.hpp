@@ -0,0 +1,64 @@
+/// @ref gtx_transform_array
+/// @file glm/gtx/transform_array.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_transform_array GLM_GTX_transform_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/transform_array.hpp> to use the features of this extension.
+///
+/// Transforms whole vertex arrays by one matrix. With SSE2 the arrays run
+/// through the glm/simd/matrix.h kernels, which use AVX or FMA when the
+/// CPU has them. The results are the same bits as the matrix times each
+/// vertex, except for vec4 arrays on AVX2 CPUs, where FMA rounds once
+/// instead of twice.
+
+#pragma once
+
+// Dependency:
+#include "../vec2.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include "../mat3x2.hpp"
+#include "../mat4x4.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_transform_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_transform_array extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_array
+	/// @{
+
+	/// out[i] = m * in[i] for count vertices. in and out may be the same array.
+	///
+	/// @see gtx_transform_array
+	GLM_FUNC_DECL void transform(vec4 const* in, mat4 const& m, vec4* out, std::size_t count);
+
+	/// out[i] = m * vec4(in[i], 1) for count points. in and out must not overlap.
+	///
+	/// @see gtx_transform_array
+	GLM_FUNC_DECL void transform(vec3 const* in, mat4 const& m, vec4* out, std::size_t count);
+
+	/// out[i] = m * vec4(in[i], 0, 1) for count points. in and out must not overlap.
+	///
+	/// @see gtx_transform_array
+	GLM_FUNC_DECL void transform(vec2 const* in, mat4 const& m, vec4* out, std::size_t count);
+
+	/// out[i] = m * vec3(in[i], 1) for count points, m being a 2D affine
+	/// transform. in and out may be the same array.
+	///
+	/// @see gtx_transform_array
+	GLM_FUNC_DECL void transform(vec2 const* in, mat3x2 const& m, vec2* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "transform_array.inl"
@@ -0,0 +1,60 @@
+/// @ref gtx_transform_array
+/// @file glm/gtx/transform_array.inl
+
+#include "../simd/matrix.h"
+
+namespace glm
+{
+	GLM_FUNC_QUALIFIER void transform(vec4 const* in, mat4 const& m, vec4* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_vec4 const col[4] = {_mm_loadu_ps(&m[0].x), _mm_loadu_ps(&m[1].x), _mm_loadu_ps(&m[2].x), _mm_loadu_ps(&m[3].x)};
+			glm_mat4_mul_vec4_array(col, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * in[i];
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void transform(vec3 const* in, mat4 const& m, vec4* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_vec4 const col[4] = {_mm_loadu_ps(&m[0].x), _mm_loadu_ps(&m[1].x), _mm_loadu_ps(&m[2].x), _mm_loadu_ps(&m[3].x)};
+			glm_mat4_mul_vec3_array(col, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * vec4(in[i], 1.0f);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void transform(vec2 const* in, mat4 const& m, vec4* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_vec4 const col[4] = {_mm_loadu_ps(&m[0].x), _mm_loadu_ps(&m[1].x), _mm_loadu_ps(&m[2].x), _mm_loadu_ps(&m[3].x)};
+			glm_mat4_mul_vec2_array(col, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * vec4(in[i], 0.0f, 1.0f);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void transform(vec2 const* in, mat3x2 const& m, vec2* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_vec4 const col[3] = {
+				_mm_setr_ps(m[0].x, m[0].y, m[0].x, m[0].y),
+				_mm_setr_ps(m[1].x, m[1].y, m[1].x, m[1].y),
+				_mm_setr_ps(m[2].x, m[2].y, m[2].x, m[2].y)};
+			for(std::size_t const simdCount = count & ~std::size_t(3); i < simdCount; i += 4)
+			{
+				glm_vec4 const r0 = glm_mat3x2_mul_vec2x2(col, _mm_loadu_ps(&in[i].x));
+				glm_vec4 const r1 = glm_mat3x2_mul_vec2x2(col, _mm_loadu_ps(&in[i + 2].x));
+				_mm_storeu_ps(&out[i].x, r0);
+				_mm_storeu_ps(&out[i + 2].x, r1);
+			}
+#		endif
+		for(; i < count; ++i)
+			out[i] = m * vec3(in[i], 1.0f);
+	}
+}//namespace glm
@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include "cpu.h"
+#include <cstddef>
+#include <cstring>
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
 GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave(glm_uvec4 x)
@@ -112,4 +116,102 @@ GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave2(glm_uvec4 x, glm_uvec4 y)
 	return Reg1;
 }
 
+// The low 16 bits of each lane moved to its even bits, the odd bits zero
+GLM_FUNC_QUALIFIER glm_uvec4 glm_u32vec4_spread16(glm_uvec4 x)
+{
+	glm_uvec4 const Reg0 = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(x, 8), x), _mm_set1_epi32(0x00FF00FF));
+	glm_uvec4 const Reg1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(Reg0, 4), Reg0), _mm_set1_epi32(0x0F0F0F0F));
+	glm_uvec4 const Reg2 = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(Reg1, 2), Reg1), _mm_set1_epi32(0x33333333));
+	return _mm_and_si128(_mm_or_si128(_mm_slli_epi32(Reg2, 1), Reg2), _mm_set1_epi32(0x55555555));
+}
+
+// (v - min) * scale clamped to [0, 65535] and truncated. NaN becomes 0.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_vec4_quantize16(glm_vec4 v, glm_vec4 min, glm_vec4 scale)
+{
+	glm_vec4 const max0 = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(v, min), scale), _mm_setzero_ps());
+	return _mm_cvttps_epi32(_mm_min_ps(max0, _mm_set1_ps(65535.0f)));
+}
+
+// Morton codes of the count points (x[i], y[i]). Each coordinate goes
+// through glm_vec4_quantize16, then the bits of x fill the even bits of
+// the key and those of y the odd ones, as bitfieldInterleave(uint16,
+// uint16). glm_morton2_encode picks the widest version the CPU runs.
+GLM_FUNC_QUALIFIER void glm_morton2_encode_sse(float const* x, float const* y, std::size_t count, float minX, float minY, float scaleX, float scaleY, unsigned int* keys)
+{
+	glm_vec4 const minX0 = _mm_set1_ps(minX);
+	glm_vec4 const minY0 = _mm_set1_ps(minY);
+	glm_vec4 const scaleX0 = _mm_set1_ps(scaleX);
+	glm_vec4 const scaleY0 = _mm_set1_ps(scaleY);
+
+	std::size_t i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_uvec4 const qx = glm_vec4_quantize16(_mm_loadu_ps(x + i), minX0, scaleX0);
+		glm_uvec4 const qy = glm_vec4_quantize16(_mm_loadu_ps(y + i), minY0, scaleY0);
+		glm_uvec4 const key = _mm_or_si128(glm_u32vec4_spread16(qx), _mm_slli_epi32(glm_u32vec4_spread16(qy), 1));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(keys + i), key);
+	}
+	if(i < count)
+	{
+		float px[4] = {0}, py[4] = {0};
+		unsigned int pk[4];
+		std::memcpy(px, x + i, (count - i) * sizeof(float));
+		std::memcpy(py, y + i, (count - i) * sizeof(float));
+		glm_morton2_encode_sse(px, py, 4, minX, minY, scaleX, scaleY, pk);
+		std::memcpy(keys + i, pk, (count - i) * sizeof(unsigned int));
+	}
+}
+
+#if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+
+GLM_SIMD_TARGET("avx2") inline __m256i glm_u32vec8_spread16_avx2(__m256i x)
+{
+	__m256i const Reg0 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi32(x, 8), x), _mm256_set1_epi32(0x00FF00FF));
+	__m256i const Reg1 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi32(Reg0, 4), Reg0), _mm256_set1_epi32(0x0F0F0F0F));
+	__m256i const Reg2 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi32(Reg1, 2), Reg1), _mm256_set1_epi32(0x33333333));
+	return _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi32(Reg2, 1), Reg2), _mm256_set1_epi32(0x55555555));
+}
+
+GLM_SIMD_TARGET("avx2") inline __m256i glm_vec8_quantize16_avx2(__m256 v, __m256 min, __m256 scale)
+{
+	__m256 const max0 = _mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(v, min), scale), _mm256_setzero_ps());
+	return _mm256_cvttps_epi32(_mm256_min_ps(max0, _mm256_set1_ps(65535.0f)));
+}
+
+GLM_SIMD_TARGET("avx2") inline void glm_morton2_encode_avx2(float const* x, float const* y, std::size_t count, float minX, float minY, float scaleX, float scaleY, unsigned int* keys)
+{
+	__m256 const minX0 = _mm256_set1_ps(minX);
+	__m256 const minY0 = _mm256_set1_ps(minY);
+	__m256 const scaleX0 = _mm256_set1_ps(scaleX);
+	__m256 const scaleY0 = _mm256_set1_ps(scaleY);
+
+	std::size_t i = 0;
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256i const qx = glm_vec8_quantize16_avx2(_mm256_loadu_ps(x + i), minX0, scaleX0);
+		__m256i const qy = glm_vec8_quantize16_avx2(_mm256_loadu_ps(y + i), minY0, scaleY0);
+		__m256i const key = _mm256_or_si256(glm_u32vec8_spread16_avx2(qx), _mm256_slli_epi32(glm_u32vec8_spread16_avx2(qy), 1));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(keys + i), key);
+	}
+	glm_morton2_encode_sse(x + i, y + i, count - i, minX, minY, scaleX, scaleY, keys + i);
+}
+
+#endif//GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+
+GLM_FUNC_QUALIFIER void glm_morton2_encode(float const* x, float const* y, std::size_t count, float minX, float minY, float scaleX, float scaleY, unsigned int* keys)
+{
+#	if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+#		if GLM_SIMD_DISPATCH
+			int const Arch = GLM_ARCH | glm_cpu_arch();
+#		else
+			int const Arch = GLM_ARCH;
+#		endif
+
+		if(Arch & GLM_ARCH_AVX2_BIT)
+			glm_morton2_encode_avx2(x, y, count, minX, minY, scaleX, scaleY, keys);
+		else
+#	endif
+			glm_morton2_encode_sse(x, y, count, minX, minY, scaleX, scaleY, keys);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -4,6 +4,9 @@
 #pragma once
 
 #include "geometric.h"
+#include "cpu.h"
+#include <cstddef>
+#include <cstring>
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -77,8 +80,69 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
 	return f2;
 }
 
+#if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+// Two vertices per instruction: m * v for the vec4 in each 128-bit half of
+// v. m holds every column of the matrix in both halves.
+GLM_SIMD_TARGET("avx") inline __m256 glm_mat4_mul_vec4x2_avx(__m256 const m[4], __m256 v)
+{
+	__m256 const v0 = _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0));
+	__m256 const v1 = _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1));
+	__m256 const v2 = _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2));
+	__m256 const v3 = _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m256 const m0 = _mm256_mul_ps(m[0], v0);
+	__m256 const m1 = _mm256_mul_ps(m[1], v1);
+	__m256 const m2 = _mm256_mul_ps(m[2], v2);
+	__m256 const m3 = _mm256_mul_ps(m[3], v3);
+
+	__m256 const a0 = _mm256_add_ps(m0, m1);
+	__m256 const a1 = _mm256_add_ps(m2, m3);
+	return _mm256_add_ps(a0, a1);
+}
+
+// glm_mat4_mul_vec4x2_avx with FMA, 4 instead of 7 arithmetic instructions
+GLM_SIMD_TARGET("avx2,fma") inline __m256 glm_mat4_mul_vec4x2_fma(__m256 const m[4], __m256 v)
+{
+	__m256 const v0 = _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0));
+	__m256 const v1 = _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1));
+	__m256 const v2 = _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2));
+	__m256 const v3 = _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m256 const mul0 = _mm256_mul_ps(m[0], v0);
+	__m256 const mul1 = _mm256_mul_ps(m[1], v1);
+	__m256 const mad0 = _mm256_fmadd_ps(m[2], v2, mul0);
+	__m256 const mad1 = _mm256_fmadd_ps(m[3], v3, mul1);
+	return _mm256_add_ps(mad0, mad1);
+}
+
+#endif//GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
 GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
 {
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		__m256 const m[4] = {
+			_mm256_broadcast_ps(&in1[0]),
+			_mm256_broadcast_ps(&in1[1]),
+			_mm256_broadcast_ps(&in1[2]),
+			_mm256_broadcast_ps(&in1[3])};
+
+		// Two columns of in2 per instruction
+		__m256 const c01 = _mm256_insertf128_ps(_mm256_castps128_ps256(in2[0]), in2[1], 1);
+		__m256 const c23 = _mm256_insertf128_ps(_mm256_castps128_ps256(in2[2]), in2[3], 1);
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			__m256 const r01 = glm_mat4_mul_vec4x2_fma(m, c01);
+			__m256 const r23 = glm_mat4_mul_vec4x2_fma(m, c23);
+#		else
+			__m256 const r01 = glm_mat4_mul_vec4x2_avx(m, c01);
+			__m256 const r23 = glm_mat4_mul_vec4x2_avx(m, c23);
+#		endif
+
+		out[0] = _mm256_castps256_ps128(r01);
+		out[1] = _mm256_extractf128_ps(r01, 1);
+		out[2] = _mm256_castps256_ps128(r23);
+		out[3] = _mm256_extractf128_ps(r23, 1);
+#	else
 	{
 		__m128 e0 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(0, 0, 0, 0));
 		__m128 e1 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(1, 1, 1, 1));
@@ -151,6 +215,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 
 		out[3] = a2;
 	}
+#	endif
 }
 
 GLM_FUNC_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4])
@@ -1025,4 +1090,594 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+// m * v for count vec4 stored one after the other, as in a glm::vec4 array.
+// in and out need no alignment and may be the same array. Each instruction
+// set has its own version, glm_mat4_mul_vec4_array picks the best one the
+// CPU runs. Matrix products are covered too: the columns of m * n[i] are
+// m times the columns of n[i].
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec4_array_sse(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	for(std::size_t i = 0; i < count; ++i)
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(m, _mm_loadu_ps(in + i * 4)));
+}
+
+#if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+// The last one to three vertices, through masked loads and stores
+GLM_SIMD_TARGET("avx") inline __m256i glm_vec4x2_tail_mask(std::size_t count)
+{
+	return count > 1 ? _mm256_set1_epi32(-1) : _mm256_setr_epi32(-1, -1, -1, -1, 0, 0, 0, 0);
+}
+
+GLM_SIMD_TARGET("avx") inline void glm_mat4_mul_vec4_array_avx(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	__m256 const col[4] = {
+		_mm256_broadcast_ps(&m[0]),
+		_mm256_broadcast_ps(&m[1]),
+		_mm256_broadcast_ps(&m[2]),
+		_mm256_broadcast_ps(&m[3])};
+
+	std::size_t i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		__m256 const v0 = _mm256_loadu_ps(in + i * 4);
+		__m256 const v1 = _mm256_loadu_ps(in + i * 4 + 8);
+		__m256 const r0 = glm_mat4_mul_vec4x2_avx(col, v0);
+		__m256 const r1 = glm_mat4_mul_vec4x2_avx(col, v1);
+		_mm256_storeu_ps(out + i * 4, r0);
+		_mm256_storeu_ps(out + i * 4 + 8, r1);
+	}
+	for(; i < count; i += 2)
+	{
+		__m256i const mask = glm_vec4x2_tail_mask(count - i);
+		__m256 const r0 = glm_mat4_mul_vec4x2_avx(col, _mm256_maskload_ps(in + i * 4, mask));
+		_mm256_maskstore_ps(out + i * 4, mask, r0);
+	}
+}
+
+GLM_SIMD_TARGET("avx2,fma") inline void glm_mat4_mul_vec4_array_fma(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	__m256 const col[4] = {
+		_mm256_broadcast_ps(&m[0]),
+		_mm256_broadcast_ps(&m[1]),
+		_mm256_broadcast_ps(&m[2]),
+		_mm256_broadcast_ps(&m[3])};
+
+	std::size_t i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		__m256 const v0 = _mm256_loadu_ps(in + i * 4);
+		__m256 const v1 = _mm256_loadu_ps(in + i * 4 + 8);
+		__m256 const r0 = glm_mat4_mul_vec4x2_fma(col, v0);
+		__m256 const r1 = glm_mat4_mul_vec4x2_fma(col, v1);
+		_mm256_storeu_ps(out + i * 4, r0);
+		_mm256_storeu_ps(out + i * 4 + 8, r1);
+	}
+	for(; i < count; i += 2)
+	{
+		__m256i const mask = glm_vec4x2_tail_mask(count - i);
+		__m256 const r0 = glm_mat4_mul_vec4x2_fma(col, _mm256_maskload_ps(in + i * 4, mask));
+		_mm256_maskstore_ps(out + i * 4, mask, r0);
+	}
+}
+
+#endif//GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+typedef void (*glm_mat4_mul_array_kernel)(glm_vec4 const m[4], float const* in, float* out, std::size_t count);
+
+// The kernel glm_mat4_mul_vec4_array runs. A build targeting AVX2 knows it
+// when compiling, otherwise the CPU is asked once and the choice is kept
+// as a function pointer.
+GLM_FUNC_QUALIFIER glm_mat4_mul_array_kernel glm_mat4_mul_vec4_array_kernel()
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return glm_mat4_mul_vec4_array_fma;
+#	elif GLM_SIMD_DISPATCH
+		static glm_mat4_mul_array_kernel const Kernel =
+			(glm_cpu_arch() & GLM_ARCH_AVX2_BIT) ? glm_mat4_mul_vec4_array_fma :
+			(glm_cpu_arch() & GLM_ARCH_AVX_BIT) ? glm_mat4_mul_vec4_array_avx :
+			glm_mat4_mul_vec4_array_sse;
+		return Kernel;
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+		return glm_mat4_mul_vec4_array_avx;
+#	else
+		return glm_mat4_mul_vec4_array_sse;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec4_array(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	glm_mat4_mul_vec4_array_kernel()(m, in, out, count);
+}
+
+
+// glm_mat4_mul_vec4_array for points: vec3 in read as (x, y, z, 1), vec2 in
+// as (x, y, 0, 1). out holds count vec4 and must not overlap in. The SSE2
+// and AVX versions each transform four points per loop.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_point(float x, float y, float z)
+{
+	return _mm_setr_ps(x, y, z, 1.0f);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec3_array_sse(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	glm_vec4 const xyz = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+	glm_vec4 const w = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+	// The 16 byte loads read the x of the next point, the last point of the
+	// array is left to the tail
+	std::size_t i = 0;
+	for(; i + 4 < count; i += 4)
+	{
+		glm_vec4 const v0 = _mm_or_ps(_mm_and_ps(_mm_loadu_ps(in + i * 3), xyz), w);
+		glm_vec4 const v1 = _mm_or_ps(_mm_and_ps(_mm_loadu_ps(in + i * 3 + 3), xyz), w);
+		glm_vec4 const v2 = _mm_or_ps(_mm_and_ps(_mm_loadu_ps(in + i * 3 + 6), xyz), w);
+		glm_vec4 const v3 = _mm_or_ps(_mm_and_ps(_mm_loadu_ps(in + i * 3 + 9), xyz), w);
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(m, v0));
+		_mm_storeu_ps(out + i * 4 + 4, glm_mat4_mul_vec4(m, v1));
+		_mm_storeu_ps(out + i * 4 + 8, glm_mat4_mul_vec4(m, v2));
+		_mm_storeu_ps(out + i * 4 + 12, glm_mat4_mul_vec4(m, v3));
+	}
+	for(; i < count; ++i)
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(m, glm_vec4_point(in[i * 3], in[i * 3 + 1], in[i * 3 + 2])));
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec2_array_sse(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	glm_vec4 const zw = _mm_setr_ps(0.0f, 1.0f, 0.0f, 1.0f);
+
+	std::size_t i = 0;
+	for(std::size_t const simdCount = count & ~std::size_t(3); i < simdCount; i += 4)
+	{
+		glm_vec4 const v01 = _mm_loadu_ps(in + i * 2);
+		glm_vec4 const v23 = _mm_loadu_ps(in + i * 2 + 4);
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(m, _mm_movelh_ps(v01, zw)));
+		_mm_storeu_ps(out + i * 4 + 4, glm_mat4_mul_vec4(m, _mm_movehl_ps(zw, v01)));
+		_mm_storeu_ps(out + i * 4 + 8, glm_mat4_mul_vec4(m, _mm_movelh_ps(v23, zw)));
+		_mm_storeu_ps(out + i * 4 + 12, glm_mat4_mul_vec4(m, _mm_movehl_ps(zw, v23)));
+	}
+	for(; i < count; ++i)
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(m, glm_vec4_point(in[i * 2], in[i * 2 + 1], 0.0f)));
+}
+
+#if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+GLM_SIMD_TARGET("avx") inline void glm_mat4_mul_vec3_array_avx(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	__m256 const col[4] = {
+		_mm256_broadcast_ps(&m[0]),
+		_mm256_broadcast_ps(&m[1]),
+		_mm256_broadcast_ps(&m[2]),
+		_mm256_broadcast_ps(&m[3])};
+	__m256 const xyz = _mm256_castsi256_ps(_mm256_setr_epi32(-1, -1, -1, 0, -1, -1, -1, 0));
+	__m256 const w = _mm256_setr_ps(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+
+	std::size_t i = 0;
+	for(; i + 4 < count; i += 4)
+	{
+		__m256 const v01 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + i * 3)), _mm_loadu_ps(in + i * 3 + 3), 1);
+		__m256 const v23 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + i * 3 + 6)), _mm_loadu_ps(in + i * 3 + 9), 1);
+		__m256 const r01 = glm_mat4_mul_vec4x2_avx(col, _mm256_or_ps(_mm256_and_ps(v01, xyz), w));
+		__m256 const r23 = glm_mat4_mul_vec4x2_avx(col, _mm256_or_ps(_mm256_and_ps(v23, xyz), w));
+		_mm256_storeu_ps(out + i * 4, r01);
+		_mm256_storeu_ps(out + i * 4 + 8, r23);
+	}
+	for(; i < count; ++i)
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(m, glm_vec4_point(in[i * 3], in[i * 3 + 1], in[i * 3 + 2])));
+}
+
+GLM_SIMD_TARGET("avx") inline void glm_mat4_mul_vec2_array_avx(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	__m256 const col[4] = {
+		_mm256_broadcast_ps(&m[0]),
+		_mm256_broadcast_ps(&m[1]),
+		_mm256_broadcast_ps(&m[2]),
+		_mm256_broadcast_ps(&m[3])};
+	glm_vec4 const zw = _mm_setr_ps(0.0f, 1.0f, 0.0f, 1.0f);
+
+	std::size_t i = 0;
+	for(std::size_t const simdCount = count & ~std::size_t(3); i < simdCount; i += 4)
+	{
+		glm_vec4 const v01 = _mm_loadu_ps(in + i * 2);
+		glm_vec4 const v23 = _mm_loadu_ps(in + i * 2 + 4);
+		__m256 const p01 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_movelh_ps(v01, zw)), _mm_movehl_ps(zw, v01), 1);
+		__m256 const p23 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_movelh_ps(v23, zw)), _mm_movehl_ps(zw, v23), 1);
+		_mm256_storeu_ps(out + i * 4, glm_mat4_mul_vec4x2_avx(col, p01));
+		_mm256_storeu_ps(out + i * 4 + 8, glm_mat4_mul_vec4x2_avx(col, p23));
+	}
+	for(; i < count; ++i)
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(m, glm_vec4_point(in[i * 2], in[i * 2 + 1], 0.0f)));
+}
+
+#endif//GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+// The kernel glm_mat4_mul_vec3_array runs, picked as for vec4 arrays
+GLM_FUNC_QUALIFIER glm_mat4_mul_array_kernel glm_mat4_mul_vec3_array_kernel()
+{
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		return glm_mat4_mul_vec3_array_avx;
+#	elif GLM_SIMD_DISPATCH
+		static glm_mat4_mul_array_kernel const Kernel =
+			(glm_cpu_arch() & GLM_ARCH_AVX_BIT) ? glm_mat4_mul_vec3_array_avx : glm_mat4_mul_vec3_array_sse;
+		return Kernel;
+#	else
+		return glm_mat4_mul_vec3_array_sse;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec3_array(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	glm_mat4_mul_vec3_array_kernel()(m, in, out, count);
+}
+
+// The kernel glm_mat4_mul_vec2_array runs, picked as for vec4 arrays
+GLM_FUNC_QUALIFIER glm_mat4_mul_array_kernel glm_mat4_mul_vec2_array_kernel()
+{
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		return glm_mat4_mul_vec2_array_avx;
+#	elif GLM_SIMD_DISPATCH
+		static glm_mat4_mul_array_kernel const Kernel =
+			(glm_cpu_arch() & GLM_ARCH_AVX_BIT) ? glm_mat4_mul_vec2_array_avx : glm_mat4_mul_vec2_array_sse;
+		return Kernel;
+#	else
+		return glm_mat4_mul_vec2_array_sse;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec2_array(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	glm_mat4_mul_vec2_array_kernel()(m, in, out, count);
+}
+
+// m * vec3(v, 1) for the two vec2 in v, with m a 3x2 matrix whose columns
+// are each stored twice: (m[i][0], m[i][1], m[i][0], m[i][1]).
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3x2_mul_vec2x2(glm_vec4 const m[3], glm_vec4 v)
+{
+	glm_vec4 const xx = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0));
+	glm_vec4 const yy = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+	glm_vec4 const a0 = _mm_add_ps(_mm_mul_ps(m[0], xx), _mm_mul_ps(m[1], yy));
+	return _mm_add_ps(a0, m[2]);
+}
+
+
+// Inverse of a 2D affine transform, a 3x2 matrix held as its linear part
+// (m[0][0], m[0][1], m[1][0], m[1][1]) and its translation twice
+// (m[2][0], m[2][1], m[2][0], m[2][1]). The result is held the same way.
+GLM_FUNC_QUALIFIER void glm_mat3x2_inverse(glm_vec4 lin, glm_vec4 trn, glm_vec4* outLin, glm_vec4* outTrn)
+{
+	// m[0][0] * m[1][1] - m[1][0] * m[0][1] in every lane
+	glm_vec4 const mul0 = _mm_mul_ps(lin, _mm_shuffle_ps(lin, lin, _MM_SHUFFLE(0, 1, 2, 3)));
+	glm_vec4 const sub0 = _mm_sub_ps(mul0, _mm_shuffle_ps(mul0, mul0, _MM_SHUFFLE(2, 3, 0, 1)));
+	glm_vec4 const det0 = _mm_shuffle_ps(sub0, sub0, _MM_SHUFFLE(0, 0, 0, 0));
+
+	// (m[1][1], -m[0][1], -m[1][0], m[0][0]) / det
+	glm_vec4 const sgn0 = _mm_castsi128_ps(_mm_setr_epi32(0, int(0x80000000), int(0x80000000), 0));
+	glm_vec4 const adj0 = _mm_xor_ps(_mm_shuffle_ps(lin, lin, _MM_SHUFFLE(0, 2, 1, 3)), sgn0);
+	glm_vec4 const inv0 = _mm_div_ps(adj0, det0);
+
+	glm_vec4 const xx = _mm_shuffle_ps(trn, trn, _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const yy = _mm_shuffle_ps(trn, trn, _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const mul1 = _mm_add_ps(_mm_mul_ps(_mm_movelh_ps(inv0, inv0), xx), _mm_mul_ps(_mm_movehl_ps(inv0, inv0), yy));
+
+	*outLin = inv0;
+	*outTrn = _mm_xor_ps(mul1, _mm_set1_ps(-0.0f));
+}
+
+// Inverse of four matrices side by side, one per lane: m[c * 4 + r] holds
+// element [c][r] of each of them. Laid out this way (an array of
+// structures of arrays) the cofactor expansion needs no shuffles, and each
+// lane goes through the operations of the scalar compute_inverse<4, 4> in
+// the same order, so a lane is the same bits as glm::inverse of a packed
+// glm::mat4. det receives the four determinants.
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_lanes(glm_vec4 const m[16], glm_vec4 out[16], glm_vec4* det)
+{
+	// The 2x2 minors compute_inverse names Coef00 to Coef23
+	glm_vec4 const c00 = _mm_sub_ps(_mm_mul_ps(m[10], m[15]), _mm_mul_ps(m[14], m[11]));
+	glm_vec4 const c02 = _mm_sub_ps(_mm_mul_ps(m[6], m[15]), _mm_mul_ps(m[14], m[7]));
+	glm_vec4 const c03 = _mm_sub_ps(_mm_mul_ps(m[6], m[11]), _mm_mul_ps(m[10], m[7]));
+	glm_vec4 const c04 = _mm_sub_ps(_mm_mul_ps(m[9], m[15]), _mm_mul_ps(m[13], m[11]));
+	glm_vec4 const c06 = _mm_sub_ps(_mm_mul_ps(m[5], m[15]), _mm_mul_ps(m[13], m[7]));
+	glm_vec4 const c07 = _mm_sub_ps(_mm_mul_ps(m[5], m[11]), _mm_mul_ps(m[9], m[7]));
+	glm_vec4 const c08 = _mm_sub_ps(_mm_mul_ps(m[9], m[14]), _mm_mul_ps(m[13], m[10]));
+	glm_vec4 const c10 = _mm_sub_ps(_mm_mul_ps(m[5], m[14]), _mm_mul_ps(m[13], m[6]));
+	glm_vec4 const c11 = _mm_sub_ps(_mm_mul_ps(m[5], m[10]), _mm_mul_ps(m[9], m[6]));
+	glm_vec4 const c12 = _mm_sub_ps(_mm_mul_ps(m[8], m[15]), _mm_mul_ps(m[12], m[11]));
+	glm_vec4 const c14 = _mm_sub_ps(_mm_mul_ps(m[4], m[15]), _mm_mul_ps(m[12], m[7]));
+	glm_vec4 const c15 = _mm_sub_ps(_mm_mul_ps(m[4], m[11]), _mm_mul_ps(m[8], m[7]));
+	glm_vec4 const c16 = _mm_sub_ps(_mm_mul_ps(m[8], m[14]), _mm_mul_ps(m[12], m[10]));
+	glm_vec4 const c18 = _mm_sub_ps(_mm_mul_ps(m[4], m[14]), _mm_mul_ps(m[12], m[6]));
+	glm_vec4 const c19 = _mm_sub_ps(_mm_mul_ps(m[4], m[10]), _mm_mul_ps(m[8], m[6]));
+	glm_vec4 const c20 = _mm_sub_ps(_mm_mul_ps(m[8], m[13]), _mm_mul_ps(m[12], m[9]));
+	glm_vec4 const c22 = _mm_sub_ps(_mm_mul_ps(m[4], m[13]), _mm_mul_ps(m[12], m[5]));
+	glm_vec4 const c23 = _mm_sub_ps(_mm_mul_ps(m[4], m[9]), _mm_mul_ps(m[8], m[5]));
+
+	// Cofactors, negated where column + row is odd
+	glm_vec4 const sgn = _mm_set1_ps(-0.0f);
+	glm_vec4 const i00 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[5], c00), _mm_mul_ps(m[6], c04)), _mm_mul_ps(m[7], c08));
+	glm_vec4 const i01 = _mm_xor_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[1], c00), _mm_mul_ps(m[2], c04)), _mm_mul_ps(m[3], c08)), sgn);
+	glm_vec4 const i02 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[1], c02), _mm_mul_ps(m[2], c06)), _mm_mul_ps(m[3], c10));
+	glm_vec4 const i03 = _mm_xor_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[1], c03), _mm_mul_ps(m[2], c07)), _mm_mul_ps(m[3], c11)), sgn);
+	glm_vec4 const i10 = _mm_xor_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[4], c00), _mm_mul_ps(m[6], c12)), _mm_mul_ps(m[7], c16)), sgn);
+	glm_vec4 const i11 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[0], c00), _mm_mul_ps(m[2], c12)), _mm_mul_ps(m[3], c16));
+	glm_vec4 const i12 = _mm_xor_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[0], c02), _mm_mul_ps(m[2], c14)), _mm_mul_ps(m[3], c18)), sgn);
+	glm_vec4 const i13 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[0], c03), _mm_mul_ps(m[2], c15)), _mm_mul_ps(m[3], c19));
+	glm_vec4 const i20 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[4], c04), _mm_mul_ps(m[5], c12)), _mm_mul_ps(m[7], c20));
+	glm_vec4 const i21 = _mm_xor_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[0], c04), _mm_mul_ps(m[1], c12)), _mm_mul_ps(m[3], c20)), sgn);
+	glm_vec4 const i22 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[0], c06), _mm_mul_ps(m[1], c14)), _mm_mul_ps(m[3], c22));
+	glm_vec4 const i23 = _mm_xor_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[0], c07), _mm_mul_ps(m[1], c15)), _mm_mul_ps(m[3], c23)), sgn);
+	glm_vec4 const i30 = _mm_xor_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[4], c08), _mm_mul_ps(m[5], c16)), _mm_mul_ps(m[6], c20)), sgn);
+	glm_vec4 const i31 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[0], c08), _mm_mul_ps(m[1], c16)), _mm_mul_ps(m[2], c20));
+	glm_vec4 const i32 = _mm_xor_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[0], c10), _mm_mul_ps(m[1], c18)), _mm_mul_ps(m[2], c22)), sgn);
+	glm_vec4 const i33 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(m[0], c11), _mm_mul_ps(m[1], c19)), _mm_mul_ps(m[2], c23));
+
+	// Determinant: the first column dotted with the first cofactor row
+	glm_vec4 const dot0 = _mm_add_ps(_mm_mul_ps(m[0], i00), _mm_mul_ps(m[1], i10));
+	glm_vec4 const dot1 = _mm_add_ps(_mm_mul_ps(m[2], i20), _mm_mul_ps(m[3], i30));
+	glm_vec4 const det0 = _mm_add_ps(dot0, dot1);
+	glm_vec4 const rcp0 = _mm_div_ps(_mm_set1_ps(1.0f), det0);
+
+	out[0] = _mm_mul_ps(i00, rcp0);
+	out[1] = _mm_mul_ps(i01, rcp0);
+	out[2] = _mm_mul_ps(i02, rcp0);
+	out[3] = _mm_mul_ps(i03, rcp0);
+	out[4] = _mm_mul_ps(i10, rcp0);
+	out[5] = _mm_mul_ps(i11, rcp0);
+	out[6] = _mm_mul_ps(i12, rcp0);
+	out[7] = _mm_mul_ps(i13, rcp0);
+	out[8] = _mm_mul_ps(i20, rcp0);
+	out[9] = _mm_mul_ps(i21, rcp0);
+	out[10] = _mm_mul_ps(i22, rcp0);
+	out[11] = _mm_mul_ps(i23, rcp0);
+	out[12] = _mm_mul_ps(i30, rcp0);
+	out[13] = _mm_mul_ps(i31, rcp0);
+	out[14] = _mm_mul_ps(i32, rcp0);
+	out[15] = _mm_mul_ps(i33, rcp0);
+	*det = det0;
+}
+
+// Four glm::mat4 stored one after the other, as lanes for
+// glm_mat4_inverse_lanes, and back.
+GLM_FUNC_QUALIFIER void glm_mat4_load_lanes(float const* in, glm_vec4 lanes[16])
+{
+	for(int c = 0; c < 4; ++c)
+	{
+		glm_vec4 r0 = _mm_loadu_ps(in + c * 4);
+		glm_vec4 r1 = _mm_loadu_ps(in + c * 4 + 16);
+		glm_vec4 r2 = _mm_loadu_ps(in + c * 4 + 32);
+		glm_vec4 r3 = _mm_loadu_ps(in + c * 4 + 48);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		lanes[c * 4 + 0] = r0;
+		lanes[c * 4 + 1] = r1;
+		lanes[c * 4 + 2] = r2;
+		lanes[c * 4 + 3] = r3;
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_store_lanes(glm_vec4 const lanes[16], float* out)
+{
+	for(int c = 0; c < 4; ++c)
+	{
+		glm_vec4 r0 = lanes[c * 4 + 0];
+		glm_vec4 r1 = lanes[c * 4 + 1];
+		glm_vec4 r2 = lanes[c * 4 + 2];
+		glm_vec4 r3 = lanes[c * 4 + 3];
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		_mm_storeu_ps(out + c * 4, r0);
+		_mm_storeu_ps(out + c * 4 + 16, r1);
+		_mm_storeu_ps(out + c * 4 + 32, r2);
+		_mm_storeu_ps(out + c * 4 + 48, r3);
+	}
+}
+
+// The last n matrices of an array, followed by identities up to a block
+// of width matrices.
+GLM_FUNC_QUALIFIER void glm_mat4_pad_block(float const* in, std::size_t n, std::size_t width, float* block)
+{
+	std::memcpy(block, in, n * 16 * sizeof(float));
+	for(std::size_t i = n * 16; i < width * 16; ++i)
+		block[i] = i % 5 == 0 ? 1.0f : 0.0f;
+}
+
+// Copies the first n bits of a block mask to invertible, when not NULL,
+// and returns how many of them are clear.
+GLM_FUNC_QUALIFIER std::size_t glm_mat4_inverse_flags(int bits, std::size_t n, bool* invertible)
+{
+	std::size_t singular = 0;
+	for(std::size_t j = 0; j < n; ++j)
+	{
+		bool const ok = ((bits >> j) & 1) != 0;
+		if(invertible)
+			invertible[j] = ok;
+		singular += ok ? 0 : 1;
+	}
+	return singular;
+}
+
+// Inverts the four matrices at in into out. When guarded, the ones whose
+// |determinant| is not above minDeterminant, NaN included, come out as
+// zero matrices. Returns one bit per matrix, set when it was inverted.
+GLM_FUNC_QUALIFIER int glm_mat4_inverse_block_sse(float const* in, float* out, bool guarded, float minDeterminant)
+{
+	glm_vec4 m[16], r[16], det;
+	glm_mat4_load_lanes(in, m);
+	glm_mat4_inverse_lanes(m, r, &det);
+
+	int bits = 0xF;
+	if(guarded)
+	{
+		glm_vec4 const abs0 = _mm_andnot_ps(_mm_set1_ps(-0.0f), det);
+		glm_vec4 const ok0 = _mm_cmpgt_ps(abs0, _mm_set1_ps(minDeterminant));
+		for(int k = 0; k < 16; ++k)
+			r[k] = _mm_and_ps(r[k], ok0);
+		bits = _mm_movemask_ps(ok0);
+	}
+
+	glm_mat4_store_lanes(r, out);
+	return bits;
+}
+
+// glm::inverse of count glm::mat4 stored one after the other, four or
+// eight at a time. in and out may be the same array. Unless guarded,
+// everything is inverted, like glm::inverse. Guarded, the matrices whose
+// |determinant| is not above minDeterminant come out as zero matrices,
+// whatever its sign; a NaN determinant is never above it. invertible, when
+// not NULL, receives for each matrix whether it was inverted. Returns how
+// many were not.
+GLM_FUNC_QUALIFIER std::size_t glm_mat4_inverse_array_sse(float const* in, float* out, std::size_t count, bool guarded, float minDeterminant, bool* invertible)
+{
+	std::size_t singular = 0;
+	std::size_t i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		int const bits = glm_mat4_inverse_block_sse(in + i * 16, out + i * 16, guarded, minDeterminant);
+		singular += glm_mat4_inverse_flags(bits, 4, invertible ? invertible + i : NULL);
+	}
+	if(i < count)
+	{
+		float block[64];
+		glm_mat4_pad_block(in + i * 16, count - i, 4, block);
+		int const bits = glm_mat4_inverse_block_sse(block, block, guarded, minDeterminant);
+		std::memcpy(out + i * 16, block, (count - i) * 16 * sizeof(float));
+		singular += glm_mat4_inverse_flags(bits, count - i, invertible ? invertible + i : NULL);
+	}
+	return singular;
+}
+
+#if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+// glm_mat4_inverse_lanes on eight matrices. No FMA, to keep the bits.
+GLM_SIMD_TARGET("avx") inline void glm_mat4_inverse_lanes_avx(__m256 const m[16], __m256 out[16], __m256* det)
+{
+	// The 2x2 minors compute_inverse names Coef00 to Coef23
+	__m256 const c00 = _mm256_sub_ps(_mm256_mul_ps(m[10], m[15]), _mm256_mul_ps(m[14], m[11]));
+	__m256 const c02 = _mm256_sub_ps(_mm256_mul_ps(m[6], m[15]), _mm256_mul_ps(m[14], m[7]));
+	__m256 const c03 = _mm256_sub_ps(_mm256_mul_ps(m[6], m[11]), _mm256_mul_ps(m[10], m[7]));
+	__m256 const c04 = _mm256_sub_ps(_mm256_mul_ps(m[9], m[15]), _mm256_mul_ps(m[13], m[11]));
+	__m256 const c06 = _mm256_sub_ps(_mm256_mul_ps(m[5], m[15]), _mm256_mul_ps(m[13], m[7]));
+	__m256 const c07 = _mm256_sub_ps(_mm256_mul_ps(m[5], m[11]), _mm256_mul_ps(m[9], m[7]));
+	__m256 const c08 = _mm256_sub_ps(_mm256_mul_ps(m[9], m[14]), _mm256_mul_ps(m[13], m[10]));
+	__m256 const c10 = _mm256_sub_ps(_mm256_mul_ps(m[5], m[14]), _mm256_mul_ps(m[13], m[6]));
+	__m256 const c11 = _mm256_sub_ps(_mm256_mul_ps(m[5], m[10]), _mm256_mul_ps(m[9], m[6]));
+	__m256 const c12 = _mm256_sub_ps(_mm256_mul_ps(m[8], m[15]), _mm256_mul_ps(m[12], m[11]));
+	__m256 const c14 = _mm256_sub_ps(_mm256_mul_ps(m[4], m[15]), _mm256_mul_ps(m[12], m[7]));
+	__m256 const c15 = _mm256_sub_ps(_mm256_mul_ps(m[4], m[11]), _mm256_mul_ps(m[8], m[7]));
+	__m256 const c16 = _mm256_sub_ps(_mm256_mul_ps(m[8], m[14]), _mm256_mul_ps(m[12], m[10]));
+	__m256 const c18 = _mm256_sub_ps(_mm256_mul_ps(m[4], m[14]), _mm256_mul_ps(m[12], m[6]));
+	__m256 const c19 = _mm256_sub_ps(_mm256_mul_ps(m[4], m[10]), _mm256_mul_ps(m[8], m[6]));
+	__m256 const c20 = _mm256_sub_ps(_mm256_mul_ps(m[8], m[13]), _mm256_mul_ps(m[12], m[9]));
+	__m256 const c22 = _mm256_sub_ps(_mm256_mul_ps(m[4], m[13]), _mm256_mul_ps(m[12], m[5]));
+	__m256 const c23 = _mm256_sub_ps(_mm256_mul_ps(m[4], m[9]), _mm256_mul_ps(m[8], m[5]));
+
+	// Cofactors, negated where column + row is odd
+	__m256 const sgn = _mm256_set1_ps(-0.0f);
+	__m256 const i00 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[5], c00), _mm256_mul_ps(m[6], c04)), _mm256_mul_ps(m[7], c08));
+	__m256 const i01 = _mm256_xor_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[1], c00), _mm256_mul_ps(m[2], c04)), _mm256_mul_ps(m[3], c08)), sgn);
+	__m256 const i02 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[1], c02), _mm256_mul_ps(m[2], c06)), _mm256_mul_ps(m[3], c10));
+	__m256 const i03 = _mm256_xor_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[1], c03), _mm256_mul_ps(m[2], c07)), _mm256_mul_ps(m[3], c11)), sgn);
+	__m256 const i10 = _mm256_xor_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[4], c00), _mm256_mul_ps(m[6], c12)), _mm256_mul_ps(m[7], c16)), sgn);
+	__m256 const i11 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[0], c00), _mm256_mul_ps(m[2], c12)), _mm256_mul_ps(m[3], c16));
+	__m256 const i12 = _mm256_xor_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[0], c02), _mm256_mul_ps(m[2], c14)), _mm256_mul_ps(m[3], c18)), sgn);
+	__m256 const i13 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[0], c03), _mm256_mul_ps(m[2], c15)), _mm256_mul_ps(m[3], c19));
+	__m256 const i20 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[4], c04), _mm256_mul_ps(m[5], c12)), _mm256_mul_ps(m[7], c20));
+	__m256 const i21 = _mm256_xor_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[0], c04), _mm256_mul_ps(m[1], c12)), _mm256_mul_ps(m[3], c20)), sgn);
+	__m256 const i22 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[0], c06), _mm256_mul_ps(m[1], c14)), _mm256_mul_ps(m[3], c22));
+	__m256 const i23 = _mm256_xor_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[0], c07), _mm256_mul_ps(m[1], c15)), _mm256_mul_ps(m[3], c23)), sgn);
+	__m256 const i30 = _mm256_xor_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[4], c08), _mm256_mul_ps(m[5], c16)), _mm256_mul_ps(m[6], c20)), sgn);
+	__m256 const i31 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[0], c08), _mm256_mul_ps(m[1], c16)), _mm256_mul_ps(m[2], c20));
+	__m256 const i32 = _mm256_xor_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[0], c10), _mm256_mul_ps(m[1], c18)), _mm256_mul_ps(m[2], c22)), sgn);
+	__m256 const i33 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(m[0], c11), _mm256_mul_ps(m[1], c19)), _mm256_mul_ps(m[2], c23));
+
+	// Determinant: the first column dotted with the first cofactor row
+	__m256 const dot0 = _mm256_add_ps(_mm256_mul_ps(m[0], i00), _mm256_mul_ps(m[1], i10));
+	__m256 const dot1 = _mm256_add_ps(_mm256_mul_ps(m[2], i20), _mm256_mul_ps(m[3], i30));
+	__m256 const det0 = _mm256_add_ps(dot0, dot1);
+	__m256 const rcp0 = _mm256_div_ps(_mm256_set1_ps(1.0f), det0);
+
+	out[0] = _mm256_mul_ps(i00, rcp0);
+	out[1] = _mm256_mul_ps(i01, rcp0);
+	out[2] = _mm256_mul_ps(i02, rcp0);
+	out[3] = _mm256_mul_ps(i03, rcp0);
+	out[4] = _mm256_mul_ps(i10, rcp0);
+	out[5] = _mm256_mul_ps(i11, rcp0);
+	out[6] = _mm256_mul_ps(i12, rcp0);
+	out[7] = _mm256_mul_ps(i13, rcp0);
+	out[8] = _mm256_mul_ps(i20, rcp0);
+	out[9] = _mm256_mul_ps(i21, rcp0);
+	out[10] = _mm256_mul_ps(i22, rcp0);
+	out[11] = _mm256_mul_ps(i23, rcp0);
+	out[12] = _mm256_mul_ps(i30, rcp0);
+	out[13] = _mm256_mul_ps(i31, rcp0);
+	out[14] = _mm256_mul_ps(i32, rcp0);
+	out[15] = _mm256_mul_ps(i33, rcp0);
+	*det = det0;
+}
+
+GLM_SIMD_TARGET("avx") inline int glm_mat4_inverse_block_avx(float const* in, float* out, bool guarded, float minDeterminant)
+{
+	glm_vec4 lo[16], hi[16];
+	glm_mat4_load_lanes(in, lo);
+	glm_mat4_load_lanes(in + 64, hi);
+
+	__m256 m[16], r[16], det;
+	for(int k = 0; k < 16; ++k)
+		m[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(lo[k]), hi[k], 1);
+	glm_mat4_inverse_lanes_avx(m, r, &det);
+
+	int bits = 0xFF;
+	if(guarded)
+	{
+		__m256 const abs0 = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), det);
+		__m256 const ok0 = _mm256_cmp_ps(abs0, _mm256_set1_ps(minDeterminant), _CMP_GT_OQ);
+		for(int k = 0; k < 16; ++k)
+			r[k] = _mm256_and_ps(r[k], ok0);
+		bits = _mm256_movemask_ps(ok0);
+	}
+
+	for(int k = 0; k < 16; ++k)
+	{
+		lo[k] = _mm256_castps256_ps128(r[k]);
+		hi[k] = _mm256_extractf128_ps(r[k], 1);
+	}
+	glm_mat4_store_lanes(lo, out);
+	glm_mat4_store_lanes(hi, out + 64);
+	return bits;
+}
+
+GLM_SIMD_TARGET("avx") inline std::size_t glm_mat4_inverse_array_avx(float const* in, float* out, std::size_t count, bool guarded, float minDeterminant, bool* invertible)
+{
+	std::size_t singular = 0;
+	std::size_t i = 0;
+	for(; i + 8 <= count; i += 8)
+	{
+		int const bits = glm_mat4_inverse_block_avx(in + i * 16, out + i * 16, guarded, minDeterminant);
+		singular += glm_mat4_inverse_flags(bits, 8, invertible ? invertible + i : NULL);
+	}
+	if(i < count)
+	{
+		float block[128];
+		glm_mat4_pad_block(in + i * 16, count - i, 8, block);
+		int const bits = glm_mat4_inverse_block_avx(block, block, guarded, minDeterminant);
+		std::memcpy(out + i * 16, block, (count - i) * 16 * sizeof(float));
+		singular += glm_mat4_inverse_flags(bits, count - i, invertible ? invertible + i : NULL);
+	}
+	return singular;
+}
+
+#endif//GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+GLM_FUNC_QUALIFIER std::size_t glm_mat4_inverse_array(float const* in, float* out, std::size_t count, bool guarded, float minDeterminant, bool* invertible)
+{
+#	if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+#		if GLM_SIMD_DISPATCH
+			int const Arch = GLM_ARCH | glm_cpu_arch();
+#		else
+			int const Arch = GLM_ARCH;
+#		endif
+
+		if(Arch & GLM_ARCH_AVX_BIT)
+			return glm_mat4_inverse_array_avx(in, out, count, guarded, minDeterminant, invertible);
+#	endif
+	return glm_mat4_inverse_array_sse(in, out, count, guarded, minDeterminant, invertible);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,141 @@
+/// @ref simd
+/// @file glm/simd/random.h
+
+#pragma once
+
+#include "common.h"
+#include "cpu.h"
+#include <cstddef>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Eight xoshiro128+ generators side by side, as gtx_random_stream keeps
+// them: state[w][l] is word w of generator l. Every version steps all
+// eight together, so SSE2, AVX2 and the scalar code draw the same values.
+
+// One step of four of the generators, returning their outputs
+GLM_FUNC_QUALIFIER glm_uvec4 glm_u32vec4_xoshiro128p(glm_uvec4 s[4])
+{
+	glm_uvec4 const result = _mm_add_epi32(s[0], s[3]);
+	glm_uvec4 const t = _mm_slli_epi32(s[1], 9);
+
+	s[2] = _mm_xor_si128(s[2], s[0]);
+	s[3] = _mm_xor_si128(s[3], s[1]);
+	s[1] = _mm_xor_si128(s[1], s[2]);
+	s[0] = _mm_xor_si128(s[0], s[3]);
+	s[2] = _mm_xor_si128(s[2], t);
+	s[3] = _mm_or_si128(_mm_slli_epi32(s[3], 11), _mm_srli_epi32(s[3], 21));
+
+	return result;
+}
+
+// The top 24 bits of r as a float in [0, 1)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_random_unit(glm_uvec4 r)
+{
+	return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(r, 8)), _mm_set1_ps(1.0f / 16777216.0f));
+}
+
+// cos and sin of 2 pi u, u in [0, 1]. 4 u splits into the nearest quarter
+// turn q and at most an eighth of a turn, whose sine and cosine come from
+// the polynomials of the Cephes sinf and cosf, then q rotates them.
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_turns(glm_vec4 u, glm_vec4* c, glm_vec4* s)
+{
+	glm_vec4 const t = _mm_mul_ps(u, _mm_set1_ps(4.0f));
+	glm_ivec4 const q = _mm_cvttps_epi32(_mm_add_ps(t, _mm_set1_ps(0.5f)));
+	glm_vec4 const x = _mm_mul_ps(_mm_sub_ps(t, _mm_cvtepi32_ps(q)), _mm_set1_ps(1.57079637f));
+	glm_vec4 const x2 = _mm_mul_ps(x, x);
+
+	glm_vec4 const sp0 = _mm_add_ps(_mm_mul_ps(x2, _mm_set1_ps(-1.9515295891e-4f)), _mm_set1_ps(8.3321608736e-3f));
+	glm_vec4 const sp1 = _mm_add_ps(_mm_mul_ps(x2, sp0), _mm_set1_ps(-1.6666654611e-1f));
+	glm_vec4 const sin0 = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(x, x2), sp1), x);
+
+	glm_vec4 const cp0 = _mm_add_ps(_mm_mul_ps(x2, _mm_set1_ps(2.443315711809948e-5f)), _mm_set1_ps(-1.388731625493765e-3f));
+	glm_vec4 const cp1 = _mm_add_ps(_mm_mul_ps(x2, cp0), _mm_set1_ps(4.166664568298827e-2f));
+	glm_vec4 const cos0 = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(x2, x2), cp1), _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x2, _mm_set1_ps(0.5f))));
+
+	// Odd quarters swap the two, the second and third negate the cosine,
+	// the third and fourth the sine
+	glm_vec4 const swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	glm_vec4 const cos1 = _mm_or_ps(_mm_and_ps(swap, sin0), _mm_andnot_ps(swap, cos0));
+	glm_vec4 const sin1 = _mm_or_ps(_mm_and_ps(swap, cos0), _mm_andnot_ps(swap, sin0));
+	glm_ivec4 const cosSign = _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30);
+	glm_ivec4 const sinSign = _mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30);
+
+	*c = _mm_xor_ps(cos1, _mm_castsi128_ps(cosSign));
+	*s = _mm_xor_ps(sin1, _mm_castsi128_ps(sinSign));
+}
+
+// steps draws of the eight generators: out[8 * k + l] is draw k of
+// generator l, through glm_vec4_random_unit. glm_random_uniform picks the
+// widest version the CPU runs.
+GLM_FUNC_QUALIFIER void glm_random_uniform_sse(unsigned int state[4][8], float* out, std::size_t steps)
+{
+	glm_uvec4 lo[4], hi[4];
+	for(int w = 0; w < 4; ++w)
+	{
+		lo[w] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(state[w]));
+		hi[w] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(state[w] + 4));
+	}
+
+	for(std::size_t k = 0; k < steps; ++k)
+	{
+		_mm_storeu_ps(out + k * 8, glm_vec4_random_unit(glm_u32vec4_xoshiro128p(lo)));
+		_mm_storeu_ps(out + k * 8 + 4, glm_vec4_random_unit(glm_u32vec4_xoshiro128p(hi)));
+	}
+
+	for(int w = 0; w < 4; ++w)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(state[w]), lo[w]);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(state[w] + 4), hi[w]);
+	}
+}
+
+#if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+
+GLM_SIMD_TARGET("avx2") inline void glm_random_uniform_avx2(unsigned int state[4][8], float* out, std::size_t steps)
+{
+	__m256i s0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(state[0]));
+	__m256i s1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(state[1]));
+	__m256i s2 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(state[2]));
+	__m256i s3 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(state[3]));
+	__m256 const scale = _mm256_set1_ps(1.0f / 16777216.0f);
+
+	for(std::size_t k = 0; k < steps; ++k)
+	{
+		__m256i const result = _mm256_add_epi32(s0, s3);
+		__m256i const t = _mm256_slli_epi32(s1, 9);
+		s2 = _mm256_xor_si256(s2, s0);
+		s3 = _mm256_xor_si256(s3, s1);
+		s1 = _mm256_xor_si256(s1, s2);
+		s0 = _mm256_xor_si256(s0, s3);
+		s2 = _mm256_xor_si256(s2, t);
+		s3 = _mm256_or_si256(_mm256_slli_epi32(s3, 11), _mm256_srli_epi32(s3, 21));
+
+		_mm256_storeu_ps(out + k * 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(result, 8)), scale));
+	}
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(state[0]), s0);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(state[1]), s1);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(state[2]), s2);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(state[3]), s3);
+}
+
+#endif//GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+
+GLM_FUNC_QUALIFIER void glm_random_uniform(unsigned int state[4][8], float* out, std::size_t steps)
+{
+#	if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+#		if GLM_SIMD_DISPATCH
+			int const Arch = GLM_ARCH | glm_cpu_arch();
+#		else
+			int const Arch = GLM_ARCH;
+#		endif
+
+		if(Arch & GLM_ARCH_AVX2_BIT)
+			glm_random_uniform_avx2(state, out, steps);
+		else
+#	endif
+			glm_random_uniform_sse(state, out, steps);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
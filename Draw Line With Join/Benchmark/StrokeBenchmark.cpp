@@ -0,0 +1,106 @@
+//
+//  StrokeBenchmark.cpp
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+//  StrokeTessellator on a polyline of Segments segments, printed as one
+//  JSON object: tessellate() and stitch() for each thread count, best of
+//  Runs runs in milliseconds. The polyline is a random walk, the same on
+//  every run, that turns sharply often enough for some joins to bevel.
+//  "nonfinite" counts stitched vertices with a NaN or infinite
+//  coordinate and has to stay 0.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "Stroker.h"
+
+static const size_t Segments = 1000000;
+static const int Runs = 5;
+static const float LineWidth = 5.0f;
+static const unsigned ThreadCounts[] = { 1, 2, 4, 8, 16 };
+
+// Deterministic inputs
+static unsigned int seed = 1;
+static float nextRandom(float lo, float hi)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return lo + (hi - lo) * float(seed >> 8) * (1.0f / 16777216.0f);
+}
+
+// Mostly gentle turns, one in 64 close to turning back, and now and then
+// a point repeated
+static std::vector<glm::vec2> walk()
+{
+    std::vector<glm::vec2> points;
+    points.reserve(Segments + 1);
+    glm::vec2 p(0.0f);
+    float heading = 0.0f;
+    points.push_back(p);
+    while (points.size() < Segments + 1) {
+        float turn = nextRandom(-0.3f, 0.3f);
+        if (points.size() % 64 == 0)
+            turn += 3.0f;
+        heading += turn;
+        p += glm::vec2(std::cos(heading), std::sin(heading)) * 3.0f;
+        points.push_back(p);
+        if (points.size() % 1000 == 0)
+            points.push_back(p);
+    }
+    return points;
+}
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    std::vector<glm::vec2> points = walk();
+    std::vector<StrokeVertex> vertices;
+
+    printf("{\n");
+    printf("  \"segments\": %zu,\n", Segments);
+    printf("  \"hardware_threads\": %u,\n", std::thread::hardware_concurrency());
+    printf("  \"unit\": \"ms\",\n");
+    printf("  \"results\": {");
+
+    size_t nonfinite = 0;
+    for (size_t t = 0; t < sizeof(ThreadCounts) / sizeof(ThreadCounts[0]); t++) {
+        StrokeTessellator tessellator(ThreadCounts[t]);
+        double tessellate = 1e30, stitch = 1e30;
+        size_t count = 0;
+        for (int r = 0; r < Runs; r++) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            count = tessellator.tessellate(points, LineWidth);
+            tessellate = std::min(tessellate, millisecondsSince(start));
+
+            vertices.resize(count);
+            start = std::chrono::steady_clock::now();
+            tessellator.stitch(&vertices[0]);
+            stitch = std::min(stitch, millisecondsSince(start));
+        }
+
+        nonfinite = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (!std::isfinite(vertices[i].x) || !std::isfinite(vertices[i].y) || !std::isfinite(vertices[i].nx) || !std::isfinite(vertices[i].ny))
+                nonfinite++;
+        }
+
+        printf("%s\n    \"tessellate_%u\": %.3f,", t > 0 ? "," : "", ThreadCounts[t], tessellate);
+        printf("\n    \"stitch_%u\": %.3f", ThreadCounts[t], stitch);
+        fflush(stdout);
+    }
+
+    printf("\n  },\n");
+    printf("  \"vertices\": %zu,\n", vertices.size());
+    printf("  \"nonfinite\": %zu\n", nonfinite);
+    printf("}\n");
+    return 0;
+}
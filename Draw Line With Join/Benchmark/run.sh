@@ -0,0 +1,24 @@
+#!/bin/sh
+#
+#  run.sh
+#  OpenGL Template
+#
+#  Created by Aaron Elkins on 10/19/26.
+#  Copyright © 2026 Aaron Elkins. All rights reserved.
+#
+#  Builds StrokeBenchmark.cpp against the demo's Libs and glm and prints
+#  its JSON result:
+#
+#    ./run.sh > stroke.json
+#
+#  CXX and CXXFLAGS are taken from the environment.
+
+set -e
+
+cd "$(dirname "$0")"
+CXX=${CXX:-c++}
+BUILD=${TMPDIR:-/tmp}/stroke-benchmark
+LIBS="../OpenGL Template/Libs"
+
+$CXX -std=c++11 -O2 $CXXFLAGS -I.. -I"$LIBS" StrokeBenchmark.cpp "$LIBS/Stroker.cpp" "$LIBS/Vec2Batch.cpp" -pthread -o "$BUILD"
+"$BUILD"
@@ -6,76 +6,411 @@
 //  Copyright © 2017 Aaron Elkins. All rights reserved.
 //
 #include <iostream>
+#include <fstream>
 #include <vector>
+#include <chrono>
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <dlfcn.h>
 #include <OpenGL/gl3.h>
 
 #include "GLUtil.h"
 
-GLuint LoadShaders(std::string vertexShaderCode, std::string fragmentShaderCode){
+// KHR_parallel_shader_compile, not in the system headers
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+typedef void (*MaxShaderCompilerThreadsProc)(GLuint count);
 
-    // Create the shaders
-    GLuint VertexShaderID = glCreateShader(GL_VERTEX_SHADER);
-    GLuint FragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
+static double millisecondsSince(std::chrono::steady_clock::time_point start){
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
 
-    GLint Result = GL_FALSE;
-    int InfoLogLength;
+// Inserts defines right after the #version line, which has to stay first.
+static std::string InjectDefines(const std::string &shaderCode, const std::string &defines){
+    if (defines.empty()) {
+        return shaderCode;
+    }
 
+    size_t version = shaderCode.find("#version");
+    if (version == std::string::npos) {
+        return defines + "\n" + shaderCode;
+    }
 
-    printf("Compiling shaders...\n");
+    size_t lineEnd = shaderCode.find('\n', version);
+    if (lineEnd == std::string::npos) {
+        return shaderCode + "\n" + defines + "\n";
+    }
 
-    // Compile Vertex Shader
-    char const * VertexSourcePointer = vertexShaderCode.c_str();
-    glShaderSource(VertexShaderID, 1, &VertexSourcePointer , NULL);
-    glCompileShader(VertexShaderID);
+    return shaderCode.substr(0, lineEnd + 1) + defines + "\n" + shaderCode.substr(lineEnd + 1);
+}
 
-    // Check Vertex Shader
-    glGetShaderiv(VertexShaderID, GL_COMPILE_STATUS, &Result);
-    glGetShaderiv(VertexShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
-    if ( InfoLogLength > 0 ){
-        std::vector<char> VertexShaderErrorMessage(InfoLogLength+1);
-        glGetShaderInfoLog(VertexShaderID, InfoLogLength, NULL, &VertexShaderErrorMessage[0]);
-        printf("%s\n", &VertexShaderErrorMessage[0]);
+// 64-bit FNV-1a
+static uint64_t HashString(uint64_t hash, const std::string &s){
+    for (size_t i = 0; i < s.size(); i++) {
+        hash ^= (unsigned char)s[i];
+        hash *= 1099511628211ULL;
     }
+    // Separator, so "ab" + "c" and "a" + "bc" hash differently
+    hash ^= 0xff;
+    hash *= 1099511628211ULL;
+    return hash;
+}
 
+static std::string GLString(GLenum name){
+    const GLubyte *s = glGetString(name);
+    return s ? std::string((const char *)s) : std::string();
+}
 
-    // Compile Fragment Shader
-    char const * FragmentSourcePointer = fragmentShaderCode.c_str();
-    glShaderSource(FragmentShaderID, 1, &FragmentSourcePointer , NULL);
-    glCompileShader(FragmentShaderID);
-
-    // Check Fragment Shader
-    glGetShaderiv(FragmentShaderID, GL_COMPILE_STATUS, &Result);
-    glGetShaderiv(FragmentShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+static void PrintShaderLog(GLuint shaderID){
+    int InfoLogLength = 0;
+    glGetShaderiv(shaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
     if ( InfoLogLength > 0 ){
-        std::vector<char> FragmentShaderErrorMessage(InfoLogLength+1);
-        glGetShaderInfoLog(FragmentShaderID, InfoLogLength, NULL, &FragmentShaderErrorMessage[0]);
-        printf("%s\n", &FragmentShaderErrorMessage[0]);
+        std::vector<char> ShaderErrorMessage(InfoLogLength+1);
+        glGetShaderInfoLog(shaderID, InfoLogLength, NULL, &ShaderErrorMessage[0]);
+        printf("%s\n", &ShaderErrorMessage[0]);
     }
+}
 
+// Cache file layout: binary format (GLenum), binary length, binary.
+static GLuint LoadProgramBinary(const std::string &path){
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file) {
+        return 0;
+    }
+
+    GLenum format = 0;
+    GLint length = 0;
+    file.read((char *)&format, sizeof(format));
+    file.read((char *)&length, sizeof(length));
+    if (!file || length <= 0) {
+        return 0;
+    }
+
+    std::vector<char> binary(length);
+    file.read(&binary[0], length);
+    if (!file) {
+        return 0;
+    }
 
-    // Link the program
-    printf("Linking program\n");
     GLuint ProgramID = glCreateProgram();
-    glAttachShader(ProgramID, VertexShaderID);
-    glAttachShader(ProgramID, FragmentShaderID);
-    glLinkProgram(ProgramID);
+    glProgramBinary(ProgramID, format, &binary[0], length);
 
-    // Check the program
+    // Drivers reject binaries from other versions or GPUs
+    GLint Result = GL_FALSE;
     glGetProgramiv(ProgramID, GL_LINK_STATUS, &Result);
-    glGetProgramiv(ProgramID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+    if (Result != GL_TRUE) {
+        glDeleteProgram(ProgramID);
+        return 0;
+    }
+
+    return ProgramID;
+}
+
+static void SaveProgramBinary(GLuint programID, const std::string &path){
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    GLint length = 0;
+    glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (formats <= 0 || length <= 0) {
+        return;
+    }
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(programID, length, &length, &format, &binary[0]);
+
+    std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+    file.write((const char *)&format, sizeof(format));
+    file.write((const char *)&length, sizeof(length));
+    file.write(&binary[0], length);
+}
+
+std::string DefaultShaderCacheDir(){
+    const char *tmp = getenv("TMPDIR");
+    return tmp ? std::string(tmp) : std::string("/tmp/");
+}
+
+bool FramebufferIsSRGB(){
+    GLint framebuffer = 0;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+
+    GLint encoding = GL_LINEAR;
+    GLenum attachment = framebuffer ? GL_COLOR_ATTACHMENT0 : GL_BACK_LEFT;
+    glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, attachment, GL_FRAMEBUFFER_ATTACHMENT_COLOR_ENCODING, &encoding);
+    return encoding == GL_SRGB;
+}
+
+bool SetSRGBFramebuffer(bool enable){
+    if (enable && FramebufferIsSRGB()) {
+        glEnable(GL_FRAMEBUFFER_SRGB);
+        return true;
+    }
+    glDisable(GL_FRAMEBUFFER_SRGB);
+    return false;
+}
+
+bool ShaderBatch::parallelCompileSupported(){
+    static int supported = -1;
+    if (supported < 0) {
+        supported = 0;
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; i++) {
+            const char *name = (const char *)glGetStringi(GL_EXTENSIONS, i);
+            if (name && (strcmp(name, "GL_KHR_parallel_shader_compile") == 0 || strcmp(name, "GL_ARB_parallel_shader_compile") == 0)) {
+                supported = 1;
+                break;
+            }
+        }
+
+        // Let the driver use as many threads as it likes
+        if (supported) {
+            MaxShaderCompilerThreadsProc maxThreads = (MaxShaderCompilerThreadsProc)dlsym(RTLD_DEFAULT, "glMaxShaderCompilerThreadsKHR");
+            if (maxThreads == NULL) {
+                maxThreads = (MaxShaderCompilerThreadsProc)dlsym(RTLD_DEFAULT, "glMaxShaderCompilerThreadsARB");
+            }
+            if (maxThreads != NULL) {
+                maxThreads(0xFFFFFFFF);
+            }
+        }
+    }
+    return supported == 1;
+}
+
+ShaderBatch::ShaderBatch(std::string cacheDir) : cacheDir(cacheDir){
+    if (!this->cacheDir.empty() && this->cacheDir[this->cacheDir.size() - 1] != '/') {
+        this->cacheDir += '/';
+    }
+    parallelCompileSupported();
+}
+
+size_t ShaderBatch::add(std::string vertexShaderCode, std::string fragmentShaderCode, std::string defines, std::string geometryShaderCode, const std::vector<std::string> &feedbackVaryings){
+    Entry entry;
+    entry.submitted = std::chrono::steady_clock::now();
+    entry.vertexShader = 0;
+    entry.geometryShader = 0;
+    entry.fragmentShader = 0;
+    entry.milliseconds = 0.0;
+    entry.done = false;
+    entry.linked = false;
+    entry.cached = false;
+
+    vertexShaderCode = InjectDefines(vertexShaderCode, defines);
+    fragmentShaderCode = InjectDefines(fragmentShaderCode, defines);
+    if (!geometryShaderCode.empty()) {
+        geometryShaderCode = InjectDefines(geometryShaderCode, defines);
+    }
+
+    // Defines are already part of the sources at this point. Programs
+    // without a geometry stage or captured outputs keep the keys they had
+    // before there were any.
+    uint64_t key = 14695981039346656037ULL;
+    key = HashString(key, vertexShaderCode);
+    key = HashString(key, fragmentShaderCode);
+    if (!geometryShaderCode.empty()) {
+        key = HashString(key, geometryShaderCode);
+    }
+    for (size_t i = 0; i < feedbackVaryings.size(); i++) {
+        key = HashString(key, feedbackVaryings[i]);
+    }
+    key = HashString(key, GLString(GL_VENDOR));
+    key = HashString(key, GLString(GL_RENDERER));
+    key = HashString(key, GLString(GL_VERSION));
+
+    char name[64];
+    snprintf(name, sizeof(name), "glprogram-%016llx.bin", (unsigned long long)key);
+    entry.cacheName = name;
+
+    entry.program = LoadProgramBinary(cacheDir + entry.cacheName);
+    if (entry.program != 0) {
+        entry.milliseconds = millisecondsSince(entry.submitted);
+        entry.done = true;
+        entry.linked = true;
+        entry.cached = true;
+        entries.push_back(entry);
+        return entries.size() - 1;
+    }
+
+    // Submit only. Status is not queried here, so the driver is free to
+    // keep working while the next program is submitted.
+    char const * VertexSourcePointer = vertexShaderCode.c_str();
+    entry.vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(entry.vertexShader, 1, &VertexSourcePointer , NULL);
+    glCompileShader(entry.vertexShader);
+
+    if (!geometryShaderCode.empty()) {
+        char const * GeometrySourcePointer = geometryShaderCode.c_str();
+        entry.geometryShader = glCreateShader(GL_GEOMETRY_SHADER);
+        glShaderSource(entry.geometryShader, 1, &GeometrySourcePointer , NULL);
+        glCompileShader(entry.geometryShader);
+    }
+
+    char const * FragmentSourcePointer = fragmentShaderCode.c_str();
+    entry.fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(entry.fragmentShader, 1, &FragmentSourcePointer , NULL);
+    glCompileShader(entry.fragmentShader);
+
+    entry.program = glCreateProgram();
+    glAttachShader(entry.program, entry.vertexShader);
+    if (entry.geometryShader != 0) {
+        glAttachShader(entry.program, entry.geometryShader);
+    }
+    glAttachShader(entry.program, entry.fragmentShader);
+
+    // Has to be set before linking
+    if (!feedbackVaryings.empty()) {
+        std::vector<const char *> names;
+        for (size_t i = 0; i < feedbackVaryings.size(); i++) {
+            names.push_back(feedbackVaryings[i].c_str());
+        }
+        glTransformFeedbackVaryings(entry.program, (GLsizei)names.size(), &names[0], GL_INTERLEAVED_ATTRIBS);
+    }
+
+    glProgramParameteri(entry.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(entry.program);
+
+    entries.push_back(entry);
+    return entries.size() - 1;
+}
+
+bool ShaderBatch::poll(){
+    bool parallel = parallelCompileSupported();
+    bool pending = false;
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        Entry &entry = entries[i];
+        if (entry.done) {
+            continue;
+        }
+
+        // Without the extension there is no way to ask without blocking,
+        // so the link status is read as finish() does.
+        GLint completed = GL_TRUE;
+        if (parallel) {
+            glGetProgramiv(entry.program, GL_COMPLETION_STATUS_KHR, &completed);
+        }
+        if (completed) {
+            complete(entry);
+        } else {
+            pending = true;
+        }
+    }
+
+    return !pending;
+}
+
+void ShaderBatch::finish(){
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (!entries[i].done) {
+            complete(entries[i]);
+        }
+    }
+}
+
+void ShaderBatch::complete(Entry &entry){
+    GLint Result = GL_FALSE;
+    glGetProgramiv(entry.program, GL_LINK_STATUS, &Result);
+    entry.milliseconds = millisecondsSince(entry.submitted);
+    entry.linked = Result == GL_TRUE;
+    entry.done = true;
+
+    PrintShaderLog(entry.vertexShader);
+    if (entry.geometryShader != 0) {
+        PrintShaderLog(entry.geometryShader);
+    }
+    PrintShaderLog(entry.fragmentShader);
+
+    int InfoLogLength = 0;
+    glGetProgramiv(entry.program, GL_INFO_LOG_LENGTH, &InfoLogLength);
     if ( InfoLogLength > 0 ){
         std::vector<char> ProgramErrorMessage(InfoLogLength+1);
-        glGetProgramInfoLog(ProgramID, InfoLogLength, NULL, &ProgramErrorMessage[0]);
+        glGetProgramInfoLog(entry.program, InfoLogLength, NULL, &ProgramErrorMessage[0]);
         printf("%s\n", &ProgramErrorMessage[0]);
     }
 
+    glDetachShader(entry.program, entry.vertexShader);
+    glDetachShader(entry.program, entry.fragmentShader);
+    if (entry.geometryShader != 0) {
+        glDetachShader(entry.program, entry.geometryShader);
+        glDeleteShader(entry.geometryShader);
+    }
 
-    glDetachShader(ProgramID, VertexShaderID);
-    glDetachShader(ProgramID, FragmentShaderID);
+    glDeleteShader(entry.vertexShader);
+    glDeleteShader(entry.fragmentShader);
+    entry.vertexShader = 0;
+    entry.geometryShader = 0;
+    entry.fragmentShader = 0;
 
-    glDeleteShader(VertexShaderID);
-    glDeleteShader(FragmentShaderID);
+    if (entry.linked) {
+        SaveProgramBinary(entry.program, cacheDir + entry.cacheName);
+    }
+}
 
-    return ProgramID;
+GLuint LoadShadersCached(std::string vertexShaderCode, std::string fragmentShaderCode, std::string defines, std::string cacheDir, std::string geometryShaderCode, const std::vector<std::string> &feedbackVaryings){
+    ShaderBatch batch(cacheDir);
+    batch.add(vertexShaderCode, fragmentShaderCode, defines, geometryShaderCode, feedbackVaryings);
+    batch.finish();
+
+    if (batch.cached(0)) {
+        printf("Loaded program from cache in %.2f ms\n", batch.compileMilliseconds(0));
+    } else {
+        printf("Compiled program in %.2f ms\n", batch.compileMilliseconds(0));
+    }
+
+    return batch.program(0);
+}
+
+GLuint LoadShaders(std::string vertexShaderCode, std::string fragmentShaderCode){
+    return LoadShadersCached(vertexShaderCode, fragmentShaderCode, "", DefaultShaderCacheDir());
+}
+
+GpuTimer::GpuTimer() : oldest(0), inFlight(0), running(false), totalMilliseconds(0.0), samples(0){
+    memset(queries, 0, sizeof(queries));
+}
+
+GpuTimer::~GpuTimer(){
+    if (queries[0] != 0) {
+        glDeleteQueries(QUERY_COUNT, queries);
+    }
+}
+
+void GpuTimer::begin(){
+    if (queries[0] == 0) {
+        glGenQueries(QUERY_COUNT, queries);
+    }
+    poll();
+    if (inFlight == QUERY_COUNT) {
+        return;
+    }
+    glBeginQuery(GL_TIME_ELAPSED, queries[(oldest + inFlight) % QUERY_COUNT]);
+    running = true;
+}
+
+void GpuTimer::end(){
+    if (!running) {
+        return;
+    }
+    glEndQuery(GL_TIME_ELAPSED);
+    running = false;
+    inFlight++;
+}
+
+void GpuTimer::poll(){
+    while (inFlight > 0) {
+        GLuint available = 0;
+        glGetQueryObjectuiv(queries[oldest], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return;
+        }
+
+        GLuint64 nanoseconds = 0;
+        glGetQueryObjectui64v(queries[oldest], GL_QUERY_RESULT, &nanoseconds);
+        totalMilliseconds += nanoseconds / 1e6;
+        samples++;
+        oldest = (oldest + 1) % QUERY_COUNT;
+        inFlight--;
+    }
 }
@@ -9,6 +9,118 @@
 #ifndef GLUtil_h
 #define GLUtil_h
 
+#include <string>
+#include <vector>
+#include <chrono>
+
 GLuint LoadShaders(std::string vertexShaderCode, std::string fragmentShaderCode);
 
+// Loads a linked program from the binary cache in cacheDir, or compiles it
+// from source and stores it there. The cache key hashes the sources, the
+// defines (inserted after each #version line) and the driver strings, and
+// programs the driver refuses are compiled again. An empty
+// geometryShaderCode links no geometry stage. feedbackVaryings are the
+// outputs transform feedback captures, interleaved in that order.
+GLuint LoadShadersCached(std::string vertexShaderCode, std::string fragmentShaderCode, std::string defines, std::string cacheDir, std::string geometryShaderCode = "", const std::vector<std::string> &feedbackVaryings = std::vector<std::string>());
+
+// $TMPDIR, used by LoadShaders
+std::string DefaultShaderCacheDir();
+
+// Whether the framebuffer bound for drawing stores sRGB colors, which
+// GL_FRAMEBUFFER_SRGB needs. The window framebuffer only does when
+// SDL_GL_FRAMEBUFFER_SRGB_CAPABLE was set before the window was created.
+bool FramebufferIsSRGB();
+
+// Turns GL_FRAMEBUFFER_SRGB on or off. While it is on, shaders and
+// glClearColor give linear colors, the GPU encodes them on write and
+// blends the linear values, so antialiased edges keep their weight.
+// Colors chosen in sRGB go through glm::convertSRGBToLinear first.
+// Returns whether the mode is on: false when the framebuffer is linear.
+bool SetSRGBFramebuffer(bool enable);
+
+// Compiles many programs without serializing on status queries. add() only
+// submits the compile and link, status is read in poll()/finish(). With
+// KHR_parallel_shader_compile the driver builds them on its own threads and
+// poll() can pick up finished programs without blocking.
+class ShaderBatch {
+public:
+    explicit ShaderBatch(std::string cacheDir = DefaultShaderCacheDir());
+
+    // Returns the index of the program in this batch. An empty
+    // geometryShaderCode links no geometry stage, feedbackVaryings are
+    // captured interleaved as in LoadShadersCached().
+    size_t add(std::string vertexShaderCode, std::string fragmentShaderCode, std::string defines = "", std::string geometryShaderCode = "", const std::vector<std::string> &feedbackVaryings = std::vector<std::string>());
+
+    // Completes every program the driver has finished. Returns true once
+    // nothing is pending. Never blocks with parallelCompileSupported(),
+    // without it this completes everything as finish() does and returns
+    // true.
+    bool poll();
+
+    // Completes everything, blocking on the driver where needed.
+    void finish();
+
+    size_t size() const { return entries.size(); }
+    GLuint program(size_t index) const { return entries[index].program; }
+    bool linked(size_t index) const { return entries[index].linked; }
+    bool cached(size_t index) const { return entries[index].cached; }
+
+    // Submit to completion, in milliseconds. Without the parallel extension
+    // this is mostly the time finish() spent waiting on that program.
+    double compileMilliseconds(size_t index) const { return entries[index].milliseconds; }
+
+    static bool parallelCompileSupported();
+
+private:
+    struct Entry {
+        GLuint program;
+        GLuint vertexShader;
+        GLuint geometryShader;
+        GLuint fragmentShader;
+        std::string cacheName;
+        std::chrono::steady_clock::time_point submitted;
+        double milliseconds;
+        bool done;
+        bool linked;
+        bool cached;
+    };
+
+    void complete(Entry &entry);
+
+    std::string cacheDir;
+    std::vector<Entry> entries;
+};
+
+// Times GPU work with GL_TIME_ELAPSED queries without stalling: a result
+// is read once the driver has it, usually a few frames later. Intervals
+// that start while every query is still waiting are not timed. Needs a
+// current context from the first begin() on.
+class GpuTimer {
+public:
+    GpuTimer();
+    ~GpuTimer();
+
+    void begin();
+    void end();
+
+    // Collects finished intervals. Never blocks.
+    void poll();
+
+    // Mean of the intervals collected since reset(), in milliseconds
+    double averageMilliseconds() const { return samples > 0 ? totalMilliseconds / samples : 0.0; }
+    size_t sampleCount() const { return samples; }
+    void reset() { totalMilliseconds = 0.0; samples = 0; }
+
+private:
+    static const size_t QUERY_COUNT = 4;
+
+    GLuint queries[QUERY_COUNT];
+    // Queries [oldest, oldest + inFlight) wait for their result
+    size_t oldest;
+    size_t inFlight;
+    bool running;
+    double totalMilliseconds;
+    size_t samples;
+};
+
 #endif /* GLUtil_h */
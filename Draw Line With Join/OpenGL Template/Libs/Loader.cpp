@@ -0,0 +1,162 @@
+//
+//  Loader.cpp
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+#include <stdio.h>
+#include <string.h>
+#include <SDL2/SDL.h>
+#include <OpenGL/gl3.h>
+
+#include "Loader.h"
+
+BackgroundLoader::BackgroundLoader(SDL_Window *window, SDL_GLContext renderContext)
+    : loaderWindow(NULL), loaderContext(NULL), quit(false), unpackBuffer(0) {
+    // The loader context gets its own hidden window so the two threads never
+    // fight over the drawable of the visible one.
+    loaderWindow = SDL_CreateWindow("Loader", 0, 0, 1, 1, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+    if (loaderWindow == NULL) {
+        printf("Loader window could not be created! SDL Error: %s\n", SDL_GetError());
+        return;
+    }
+
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+    loaderContext = SDL_GL_CreateContext(loaderWindow);
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+    if (loaderContext == NULL) {
+        printf("Loader context could not be created! SDL Error: %s\n", SDL_GetError());
+    }
+
+    // Creating a context makes it current, hand the render context back.
+    SDL_GL_MakeCurrent(window, renderContext);
+
+    if (loaderContext != NULL) {
+        thread = std::thread(&BackgroundLoader::threadLoop, this);
+    }
+}
+
+BackgroundLoader::~BackgroundLoader() {
+    if (thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        wake.notify_one();
+        thread.join();
+    }
+
+    for (size_t i = 0; i < submitted.size(); i++) {
+        glDeleteSync(submitted[i].fence);
+    }
+
+    if (loaderContext != NULL) {
+        SDL_GL_DeleteContext(loaderContext);
+    }
+    if (loaderWindow != NULL) {
+        SDL_DestroyWindow(loaderWindow);
+    }
+}
+
+void BackgroundLoader::enqueue(const std::function<void()> &work, const std::function<void()> &publish) {
+    Job job;
+    job.work = work;
+    job.publish = publish;
+    job.fence = NULL;
+
+    if (!valid()) {
+        // No shared context, fall back to loading on the render thread.
+        work();
+        publish();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(job);
+    }
+    wake.notify_one();
+}
+
+void BackgroundLoader::uploadTexture(GLuint texture, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels, size_t size) {
+    if (unpackBuffer == 0) {
+        glGenBuffers(1, &unpackBuffer);
+    }
+
+    // Orphans the storage of the previous upload, which the GPU may still
+    // be reading, instead of waiting for it.
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffer);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+    void *dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (dst != NULL) {
+        memcpy(dst, pixels, size);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+        // With an unpack buffer bound the last argument is an offset into it
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, format, type, (void*)0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    } else {
+        printf("Could not map the texture upload buffer\n");
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void BackgroundLoader::poll() {
+    for (;;) {
+        Job job;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (submitted.empty()) {
+                return;
+            }
+            job = submitted.front();
+        }
+
+        // Zero timeout: only look at the fence, never wait on it.
+        GLenum status = glClientWaitSync(job.fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            submitted.pop_front();
+        }
+        glDeleteSync(job.fence);
+        job.publish();
+    }
+}
+
+void BackgroundLoader::threadLoop() {
+    SDL_GL_MakeCurrent(loaderWindow, loaderContext);
+
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return quit || !pending.empty(); });
+            if (quit) {
+                break;
+            }
+            job = pending.front();
+            pending.pop_front();
+        }
+
+        job.work();
+
+        // The flush makes sure the fence reaches the GPU and can signal
+        // without anyone waiting on this context.
+        job.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        submitted.push_back(job);
+    }
+
+    if (unpackBuffer != 0) {
+        glDeleteBuffers(1, &unpackBuffer);
+    }
+    SDL_GL_MakeCurrent(loaderWindow, NULL);
+}
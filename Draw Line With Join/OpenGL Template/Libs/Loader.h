@@ -0,0 +1,69 @@
+//
+//  Loader.h
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+
+#ifndef Loader_h
+#define Loader_h
+
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+// Runs buffer and texture uploads on a thread that owns a second GL context
+// sharing objects with the render context. Each finished job is fenced, and
+// its publish step runs on the render thread once the fence has signaled,
+// so the render loop keeps presenting the previous data until then.
+class BackgroundLoader {
+public:
+    // Must be called on the render thread while renderContext is current.
+    BackgroundLoader(SDL_Window *window, SDL_GLContext renderContext);
+    ~BackgroundLoader();
+
+    bool valid() const { return loaderContext != NULL; }
+
+    // work runs on the loader thread with the shared context current.
+    // publish runs on the render thread from poll() after the GPU finished
+    // everything work submitted.
+    void enqueue(const std::function<void()> &work, const std::function<void()> &publish);
+
+    // Fills level 0 of texture, whose storage is already allocated, with
+    // width x height pixels. For use in work(): the pixels are copied into
+    // a pixel unpack buffer on the loader thread, and the GPU pulls the
+    // texels from there without the render thread waiting on it. Rows are
+    // padded to GL's default unpack alignment of 4 bytes.
+    void uploadTexture(GLuint texture, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels, size_t size);
+
+    // Publishes finished jobs in submission order. Never blocks, call it
+    // once per frame from the render thread.
+    void poll();
+
+private:
+    struct Job {
+        std::function<void()> work;
+        std::function<void()> publish;
+        GLsync fence;
+    };
+
+    void threadLoop();
+
+    SDL_Window *loaderWindow;
+    SDL_GLContext loaderContext;
+    std::thread thread;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<Job> pending;
+    std::deque<Job> submitted;
+    bool quit;
+
+    // Staging for uploadTexture(), only touched on the loader thread
+    GLuint unpackBuffer;
+};
+
+#endif /* Loader_h */
@@ -0,0 +1,291 @@
+//
+//  Stroker.cpp
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/spline_array.hpp>
+
+#include "Stroker.h"
+
+size_t strokeSegments(const Vec2Batch &points, const PolylineJoins &joins, size_t first, size_t last, float miterLimit, StrokeVertex *out) {
+    StrokeVertex *v = out;
+
+    for (size_t i = first; i < last; i++) {
+        glm::vec2 a = points[i];
+        glm::vec2 b = points[i + 1];
+        glm::vec2 cwNormal = joins.normals[i];
+        glm::vec2 ccwNormal = cwNormal * -1.0f;
+
+        // Written so a NaN ratio bevels too. The ends of the line have a
+        // ratio of 1.
+        bool bevelStart = !(joins.miterRatios[i] <= miterLimit);
+        bool bevelEnd = !(joins.miterRatios[i + 1] <= miterLimit);
+        glm::vec2 startOffset = bevelStart ? cwNormal * joins.halfWidth : joins.offsets[i];
+        glm::vec2 endOffset = bevelEnd ? cwNormal * joins.halfWidth : joins.offsets[i + 1];
+
+        glm::vec2 startUp = a + startOffset;
+        glm::vec2 startDown = a - startOffset;
+        glm::vec2 endUp = b + endOffset;
+        glm::vec2 endDown = b - endOffset;
+
+        StrokeVertex quad[6] = {
+            { startUp[0], startUp[1], cwNormal[0], cwNormal[1] },
+            { startDown[0], startDown[1], ccwNormal[0], ccwNormal[1] },
+            { endDown[0], endDown[1], ccwNormal[0], ccwNormal[1] },
+            { endDown[0], endDown[1], ccwNormal[0], ccwNormal[1] },
+            { endUp[0], endUp[1], cwNormal[0], cwNormal[1] },
+            { startUp[0], startUp[1], cwNormal[0], cwNormal[1] }
+        };
+        memcpy(v, quad, sizeof(quad));
+        v += STROKE_VERTICES_PER_SEGMENT;
+
+        if (bevelEnd) {
+            // Fills the notch on the outer side of the turn, like the
+            // bevel of the instanced stroke.vert
+            glm::vec2 nextNormal = joins.normals[i + 1];
+            float outer = glm::dot(b - a, nextNormal) > 0.0f ? 1.0f : -1.0f;
+            glm::vec2 side = cwNormal * outer;
+            glm::vec2 nextSide = nextNormal * outer;
+            glm::vec2 sideCorner = b + side * joins.halfWidth;
+            glm::vec2 nextCorner = b + nextSide * joins.halfWidth;
+
+            StrokeVertex bevel[3] = {
+                { b[0], b[1], 0.0f, 0.0f },
+                { sideCorner[0], sideCorner[1], side[0], side[1] },
+                { nextCorner[0], nextCorner[1], nextSide[0], nextSide[1] }
+            };
+            memcpy(v, bevel, sizeof(bevel));
+            v += 3;
+        }
+    }
+
+    return v - out;
+}
+
+// Drops every point equal to the one before it, in place.
+static void removeRepeats(Vec2Batch &points) {
+    float *x = points.x();
+    float *y = points.y();
+    size_t kept = points.size() > 0 ? 1 : 0;
+    for (size_t i = 1; i < points.size(); i++) {
+        if (x[i] != x[kept - 1] || y[i] != y[kept - 1]) {
+            x[kept] = x[i];
+            y[kept] = y[i];
+            kept++;
+        }
+    }
+    points.resize(kept);
+}
+
+StrokeTile strokeTile(glm::vec2 lo, glm::vec2 hi) {
+    StrokeTile tile;
+    tile.origin = (lo + hi) * 0.5f;
+
+    // Half the extent in at most 32767 steps
+    float extent = glm::max(hi.x - lo.x, hi.y - lo.y);
+    int exponent = 0;
+    frexpf(extent / 65534.0f, &exponent);
+    tile.step = extent > 0.0f ? ldexpf(1.0f, exponent) : 1.0f;
+    return tile;
+}
+
+void packStrokeVertices(const StrokeVertex *in, size_t count, const StrokeTile &tile, float halfWidth, PackedStrokeVertex *out) {
+    float scale = 1.0f / tile.step;
+    uint16_t width = glm::packHalf1x16(halfWidth);
+
+    for (size_t i = 0; i < count; i++) {
+        PackedStrokeVertex &v = out[i];
+        v.x = (int16_t)glm::round((in[i].x - tile.origin.x) * scale);
+        v.y = (int16_t)glm::round((in[i].y - tile.origin.y) * scale);
+        v.nx = (int8_t)glm::packSnorm1x8(in[i].nx);
+        v.ny = (int8_t)glm::packSnorm1x8(in[i].ny);
+        v.halfWidth = width;
+    }
+}
+
+JobPool::JobPool(unsigned threadCount)
+    : currentJob(NULL), jobCount(0), nextJob(0), busyWorkers(0), generation(0), quit(false) {
+    for (unsigned i = 1; i < threadCount; i++) {
+        workers.push_back(std::thread(&JobPool::workerLoop, this, i));
+    }
+}
+
+JobPool::~JobPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    wake.notify_all();
+    for (size_t i = 0; i < workers.size(); i++) {
+        workers[i].join();
+    }
+}
+
+void JobPool::run(size_t count, const std::function<void(unsigned, size_t)> &job) {
+    if (workers.empty() || count < 2) {
+        for (size_t i = 0; i < count; i++) {
+            job(0, i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentJob = &job;
+        jobCount = count;
+        nextJob = 0;
+        busyWorkers = (unsigned)workers.size();
+        generation++;
+    }
+    wake.notify_all();
+
+    drain(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return busyWorkers == 0; });
+    currentJob = NULL;
+}
+
+void JobPool::drain(unsigned worker) {
+    for (size_t i = nextJob++; i < jobCount; i = nextJob++) {
+        (*currentJob)(worker, i);
+    }
+}
+
+void JobPool::workerLoop(unsigned worker) {
+    unsigned long seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this, seen] { return quit || generation != seen; });
+            if (quit) {
+                return;
+            }
+            seen = generation;
+        }
+
+        drain(worker);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--busyWorkers == 0) {
+            finished.notify_one();
+        }
+    }
+}
+
+StrokeTessellator::StrokeTessellator(unsigned threadCount, size_t segmentsPerChunk)
+    : pool(threadCount > 0 ? threadCount : 1), segmentsPerChunk(segmentsPerChunk), normalizePrecision(NORMALIZE_EXACT), miterLimit(STROKE_MITER_LIMIT), totalVertices(0), halfWidth(0.0f) {
+    arenas.resize(pool.threadCount());
+}
+
+size_t StrokeTessellator::tessellate(const std::vector<glm::vec2> &points, float lineWidth) {
+    batchPoints.assign(points.empty() ? NULL : &points[0], points.size());
+    removeRepeats(batchPoints);
+    return expand(lineWidth);
+}
+
+size_t StrokeTessellator::tessellateSmooth(const std::vector<glm::vec2> &points, float lineWidth, float tolerance) {
+    // Span i runs from points[i] to points[i + 1]
+    size_t spanCount = points.size() > 1 ? points.size() - 1 : 0;
+
+    spanSegments.resize(spanCount);
+    size_t total = 0;
+    for (size_t i = 0; i < spanCount; i++) {
+        spanSegments[i] = glm::catmullRomSegments(points[i > 0 ? i - 1 : 0], points[i], points[i + 1], points[std::min(i + 2, spanCount)], tolerance);
+        total += spanSegments[i];
+    }
+
+    // Every span leaves out its end point, the last one is added after
+    batchPoints.resize(spanCount > 0 ? total + 1 : points.size());
+    size_t offset = 0;
+    for (size_t i = 0; i < spanCount; i++) {
+        glm::catmullRom(points[i > 0 ? i - 1 : 0], points[i], points[i + 1], points[std::min(i + 2, spanCount)],
+                        spanSegments[i], batchPoints.x() + offset, batchPoints.y() + offset);
+        offset += spanSegments[i];
+    }
+    if (!points.empty()) {
+        batchPoints.set(offset, points.back());
+    }
+
+    // Repeated input points give spans of one repeated point
+    removeRepeats(batchPoints);
+    return expand(lineWidth);
+}
+
+size_t StrokeTessellator::expand(float lineWidth) {
+    for (size_t i = 0; i < arenas.size(); i++) {
+        arenas[i].clear();
+    }
+
+    size_t segmentCount = batchPoints.size() > 1 ? batchPoints.size() - 1 : 0;
+    size_t chunkCount = (segmentCount + segmentsPerChunk - 1) / segmentsPerChunk;
+    chunks.resize(chunkCount);
+
+    // Normals and miters of the whole polyline in one SIMD pass, the chunks
+    // only add them to the points.
+    halfWidth = lineWidth / 2.0f;
+    batchJoins(batchPoints, halfWidth, joins, normalizePrecision);
+
+    pool.run(chunkCount, [&](unsigned worker, size_t index) {
+        size_t first = index * segmentsPerChunk;
+        size_t last = std::min(first + segmentsPerChunk, segmentCount);
+
+        std::vector<StrokeVertex> &arena = arenas[worker];
+        size_t offset = arena.size();
+        arena.resize(offset + (last - first) * STROKE_MAX_VERTICES_PER_SEGMENT);
+
+        Chunk &chunk = chunks[index];
+        chunk.worker = worker;
+        chunk.arenaOffset = offset;
+        chunk.count = strokeSegments(batchPoints, joins, first, last, miterLimit, &arena[offset]);
+        arena.resize(offset + chunk.count);
+
+        chunk.lo = glm::vec2(INFINITY);
+        chunk.hi = glm::vec2(-INFINITY);
+        for (size_t i = 0; i < chunk.count; i++) {
+            glm::vec2 p(arena[offset + i].x, arena[offset + i].y);
+            chunk.lo = glm::min(chunk.lo, p);
+            chunk.hi = glm::max(chunk.hi, p);
+        }
+    });
+
+    // Prefix sum over chunk sizes gives each chunk its place in the output.
+    totalVertices = 0;
+    for (size_t i = 0; i < chunks.size(); i++) {
+        chunks[i].outputOffset = totalVertices;
+        totalVertices += chunks[i].count;
+    }
+
+    return totalVertices;
+}
+
+void StrokeTessellator::stitch(StrokeVertex *dst) const {
+    for (size_t i = 0; i < chunks.size(); i++) {
+        const Chunk &chunk = chunks[i];
+        memcpy(dst + chunk.outputOffset, &arenas[chunk.worker][chunk.arenaOffset], chunk.count * sizeof(StrokeVertex));
+    }
+}
+
+void StrokeTessellator::stitchPacked(PackedStrokeVertex *dst, const StrokeTile &tile) {
+    pool.run(chunks.size(), [&](unsigned, size_t index) {
+        const Chunk &chunk = chunks[index];
+        packStrokeVertices(&arenas[chunk.worker][chunk.arenaOffset], chunk.count, tile, halfWidth, dst + chunk.outputOffset);
+    });
+}
+
+StrokeTile StrokeTessellator::tile() const {
+    glm::vec2 lo(0.0f), hi(0.0f);
+    for (size_t i = 0; i < chunks.size(); i++) {
+        lo = i > 0 ? glm::min(lo, chunks[i].lo) : chunks[i].lo;
+        hi = i > 0 ? glm::max(hi, chunks[i].hi) : chunks[i].hi;
+    }
+    return strokeTile(lo, hi);
+}
@@ -0,0 +1,155 @@
+//
+//  Stroker.h
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+
+#ifndef Stroker_h
+#define Stroker_h
+
+#include <stdint.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <glm/vec2.hpp>
+
+#include "Vec2Batch.h"
+
+// One expanded stroke vertex: position and the extrusion normal the
+// fragment shader turns into feathered coverage.
+struct StrokeVertex {
+    float x, y;
+    float nx, ny;
+};
+
+// StrokeVertex in 8 bytes instead of 16, for STROKE_PACKED shaders. The
+// position is in steps of a StrokeTile, the normal in 1/127 steps and
+// halfWidth is a half float, so strokes of different widths can share a
+// buffer.
+struct PackedStrokeVertex {
+    int16_t x, y;
+    int8_t nx, ny;
+    uint16_t halfWidth;
+};
+
+// Packed positions are origin + step * (x, y). step is a power of two, so
+// quantizing is exact up to rounding to the nearest step.
+struct StrokeTile {
+    glm::vec2 origin;
+    float step;
+};
+
+// The tile with the smallest step that holds [lo, hi] in int16.
+StrokeTile strokeTile(glm::vec2 lo, glm::vec2 hi);
+
+// Quantizes count vertices of a stroke of the given half width into out.
+void packStrokeVertices(const StrokeVertex *in, size_t count, const StrokeTile &tile, float halfWidth, PackedStrokeVertex *out);
+
+// Every segment expands to two triangles, and one more where its end is
+// bevelled.
+const size_t STROKE_VERTICES_PER_SEGMENT = 6;
+const size_t STROKE_MAX_VERTICES_PER_SEGMENT = 9;
+
+// Joins whose miter would reach further than this many half widths from
+// the point are bevelled instead, SVG's default stroke-miterlimit.
+const float STROKE_MITER_LIMIT = 4.0f;
+
+// Expands segments [first, last) of a polyline into quads, with the joins
+// batchJoins() computed for the whole polyline. A join is mitered unless
+// its miter ratio is over miterLimit, or NaN where the line turns back on
+// itself; then both segments end square and a triangle fills the outer
+// side. Writes up to (last - first) * STROKE_MAX_VERTICES_PER_SEGMENT
+// vertices to out and returns the number written.
+size_t strokeSegments(const Vec2Batch &points, const PolylineJoins &joins, size_t first, size_t last, float miterLimit, StrokeVertex *out);
+
+// Small persistent thread pool. Jobs are claimed from a shared cursor, so an
+// idle worker always picks up the next unclaimed chunk.
+class JobPool {
+public:
+    explicit JobPool(unsigned threadCount);
+    ~JobPool();
+
+    unsigned threadCount() const { return (unsigned)workers.size() + 1; }
+
+    // Calls job(worker, index) for every index in [0, jobCount) and blocks
+    // until all of them finished. The calling thread works as worker 0.
+    void run(size_t jobCount, const std::function<void(unsigned, size_t)> &job);
+
+private:
+    void workerLoop(unsigned worker);
+    void drain(unsigned worker);
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    const std::function<void(unsigned, size_t)> *currentJob;
+    size_t jobCount;
+    std::atomic<size_t> nextJob;
+    unsigned busyWorkers;
+    unsigned long generation;
+    bool quit;
+};
+
+// Tessellates polylines in parallel. Each worker writes into its own arena,
+// then stitch() copies the chunks in polyline order using prefix-sum offsets,
+// so the GL thread only has to map a buffer and copy.
+class StrokeTessellator {
+public:
+    explicit StrokeTessellator(unsigned threadCount, size_t segmentsPerChunk = 4096);
+
+    // Returns the number of vertices the next stitch() will write. Points
+    // equal to the one before are skipped, they have no direction.
+    size_t tessellate(const std::vector<glm::vec2> &points, float lineWidth);
+    // Strokes the Catmull-Rom spline through points instead of the polyline,
+    // the end points repeated as outer control points. Each span is
+    // sampled by forward differencing straight into the point buffer, in
+    // as many chords as its curvature needs to stay within tolerance
+    // pixels of the curve, one for a straight run.
+    size_t tessellateSmooth(const std::vector<glm::vec2> &points, float lineWidth, float tolerance = 0.25f);
+    void stitch(StrokeVertex *dst) const;
+    // stitch() through packStrokeVertices(), tile() being a good tile
+    void stitchPacked(PackedStrokeVertex *dst, const StrokeTile &tile);
+
+    // The tile around every vertex of the last tessellation
+    StrokeTile tile() const;
+
+    // NORMALIZE_EXACT unless set, see NormalizePrecision
+    void setNormalizePrecision(NormalizePrecision precision) { normalizePrecision = precision; }
+    // STROKE_MITER_LIMIT unless set, see strokeSegments()
+    void setMiterLimit(float limit) { miterLimit = limit; }
+
+    size_t vertexCount() const { return totalVertices; }
+    unsigned threadCount() const { return pool.threadCount(); }
+
+private:
+    // Expands batchPoints
+    size_t expand(float lineWidth);
+
+    struct Chunk {
+        unsigned worker;
+        size_t arenaOffset;
+        size_t count;
+        size_t outputOffset;
+        glm::vec2 lo, hi;
+    };
+
+    JobPool pool;
+    size_t segmentsPerChunk;
+    NormalizePrecision normalizePrecision;
+    float miterLimit;
+    Vec2Batch batchPoints;
+    PolylineJoins joins;
+    std::vector<std::vector<StrokeVertex> > arenas;
+    std::vector<Chunk> chunks;
+    std::vector<size_t> spanSegments;
+    size_t totalVertices;
+    float halfWidth;
+};
+
+#endif /* Stroker_h */
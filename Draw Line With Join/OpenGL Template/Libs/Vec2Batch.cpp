@@ -0,0 +1,291 @@
+//
+//  Vec2Batch.cpp
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+#include <math.h>
+#include <assert.h>
+
+#include "Vec2Batch.h"
+#include <glm/simd/cpu.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define VEC2_BATCH_SSE2 1
+#else
+#define VEC2_BATCH_SSE2 0
+#endif
+
+// GCC and Clang build the AVX and AVX-512 kernels in every x86 build, in
+// regions compiled for those targets, and glm_cpu_arch() picks the widest
+// the CPU runs. Other compilers only build what the build targets.
+#if VEC2_BATCH_SSE2 && defined(__GNUC__) && (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_SIMD_DISPATCH
+#define VEC2_BATCH_DISPATCH 1
+#else
+#define VEC2_BATCH_DISPATCH 0
+#endif
+
+#if VEC2_BATCH_DISPATCH || defined(__AVX__)
+#define VEC2_BATCH_AVX 1
+#else
+#define VEC2_BATCH_AVX 0
+#endif
+
+#if VEC2_BATCH_DISPATCH || defined(__AVX512F__)
+#define VEC2_BATCH_AVX512 1
+#else
+#define VEC2_BATCH_AVX512 0
+#endif
+
+// The steps run on these lane types: the wide ones of each instruction set,
+// and one point at a time for the tail. Each tail takes the same rsqrt
+// estimate as its wide lanes, so the last points round like the rest.
+struct ScalarLanes {
+    typedef float type;
+    static const size_t width = 1;
+
+    static type load(const float *p) { return *p; }
+    static void store(float *p, type a) { *p = a; }
+    static type set(float s) { return s; }
+    static type add(type a, type b) { return a + b; }
+    static type sub(type a, type b) { return a - b; }
+    static type mul(type a, type b) { return a * b; }
+    static type div(type a, type b) { return a / b; }
+    static type neg(type a) { return -a; }
+    static type sqrt(type a) { return ::sqrtf(a); }
+    static type rsqrt(type a) { return 1.0f / ::sqrtf(a); }
+};
+
+#if VEC2_BATCH_SSE2
+namespace sse2 {
+    struct WideLanes {
+        typedef __m128 type;
+        static const size_t width = 4;
+
+        static type load(const float *p) { return _mm_loadu_ps(p); }
+        static void store(float *p, type a) { _mm_storeu_ps(p, a); }
+        static type set(float s) { return _mm_set1_ps(s); }
+        static type add(type a, type b) { return _mm_add_ps(a, b); }
+        static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+        static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+        static type div(type a, type b) { return _mm_div_ps(a, b); }
+        static type neg(type a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+        static type sqrt(type a) { return _mm_sqrt_ps(a); }
+        static type rsqrt(type a) { return _mm_rsqrt_ps(a); }
+    };
+
+    struct TailLanes : ScalarLanes {
+        static type rsqrt(type a) { return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a))); }
+    };
+
+#include "Vec2BatchSteps.inl"
+}
+#endif
+
+#if VEC2_BATCH_AVX
+#if VEC2_BATCH_DISPATCH && defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx"))), apply_to = function)
+#elif VEC2_BATCH_DISPATCH
+#pragma GCC push_options
+#pragma GCC target("avx")
+#endif
+namespace avx {
+    struct WideLanes {
+        typedef __m256 type;
+        static const size_t width = 8;
+
+        static type load(const float *p) { return _mm256_loadu_ps(p); }
+        static void store(float *p, type a) { _mm256_storeu_ps(p, a); }
+        static type set(float s) { return _mm256_set1_ps(s); }
+        static type add(type a, type b) { return _mm256_add_ps(a, b); }
+        static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+        static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+        static type div(type a, type b) { return _mm256_div_ps(a, b); }
+        static type neg(type a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+        static type sqrt(type a) { return _mm256_sqrt_ps(a); }
+        static type rsqrt(type a) { return _mm256_rsqrt_ps(a); }
+    };
+
+    struct TailLanes : ScalarLanes {
+        static type rsqrt(type a) { return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a))); }
+    };
+
+#include "Vec2BatchSteps.inl"
+}
+#if VEC2_BATCH_DISPATCH && defined(__clang__)
+#pragma clang attribute pop
+#elif VEC2_BATCH_DISPATCH
+#pragma GCC pop_options
+#endif
+#endif
+
+#if VEC2_BATCH_AVX512
+#if VEC2_BATCH_DISPATCH && defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#elif VEC2_BATCH_DISPATCH
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#endif
+namespace avx512 {
+    struct WideLanes {
+        typedef __m512 type;
+        static const size_t width = 16;
+
+        static type load(const float *p) { return _mm512_loadu_ps(p); }
+        static void store(float *p, type a) { _mm512_storeu_ps(p, a); }
+        static type set(float s) { return _mm512_set1_ps(s); }
+        static type add(type a, type b) { return _mm512_add_ps(a, b); }
+        static type sub(type a, type b) { return _mm512_sub_ps(a, b); }
+        static type mul(type a, type b) { return _mm512_mul_ps(a, b); }
+        static type div(type a, type b) { return _mm512_div_ps(a, b); }
+        static type neg(type a) { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32(int(0x80000000)))); }
+        static type sqrt(type a) { return _mm512_sqrt_ps(a); }
+        static type rsqrt(type a) { return _mm512_rsqrt14_ps(a); }
+    };
+
+    struct TailLanes : ScalarLanes {
+        static type rsqrt(type a) { return _mm_cvtss_f32(_mm_rsqrt14_ss(_mm_setzero_ps(), _mm_set_ss(a))); }
+    };
+
+#include "Vec2BatchSteps.inl"
+}
+#if VEC2_BATCH_DISPATCH && defined(__clang__)
+#pragma clang attribute pop
+#elif VEC2_BATCH_DISPATCH
+#pragma GCC pop_options
+#endif
+#endif
+
+// Without SSE2 the scalar steps are the only kernels
+#if !VEC2_BATCH_SSE2
+namespace scalar {
+    typedef ScalarLanes WideLanes;
+    typedef ScalarLanes TailLanes;
+#include "Vec2BatchSteps.inl"
+}
+#endif
+
+// The kernels of one instruction set. Filled in outside the target
+// regions, so nothing here runs an instruction the CPU may lack.
+struct BatchKernels {
+    size_t width;
+    void (*normalize)(const Vec2Batch &v, Vec2Batch &out, NormalizePrecision precision);
+    void (*perp)(const Vec2Batch &v, Vec2Batch &out);
+    void (*dot)(const Vec2Batch &a, const Vec2Batch &b, float *out);
+    void (*length)(const Vec2Batch &v, float *out);
+    void (*lerp)(const Vec2Batch &a, const Vec2Batch &b, float t, Vec2Batch &out);
+    void (*transform)(const glm::mat3x2 &m, const Vec2Batch &v, Vec2Batch &out);
+    void (*segmentNormals)(const Vec2Batch &points, size_t segmentCount, Vec2Batch &normals, NormalizePrecision precision);
+    void (*miters)(const Vec2Batch &normals, size_t jointCount, float halfWidth, Vec2Batch &offsets, float *ratios);
+};
+
+#define VEC2_BATCH_KERNELS(isa) { isa::WideLanes::width, isa::normalize, isa::perp, isa::dot, isa::length, isa::lerp, isa::transform, isa::segmentNormals, isa::miters }
+
+static BatchKernels selectKernels() {
+#if VEC2_BATCH_DISPATCH
+    int arch = glm_cpu_arch();
+#endif
+#if VEC2_BATCH_AVX512
+#if VEC2_BATCH_DISPATCH
+    if (arch & GLM_ARCH_AVX512_BIT)
+#endif
+    {
+        BatchKernels kernels = VEC2_BATCH_KERNELS(avx512);
+        return kernels;
+    }
+#endif
+#if VEC2_BATCH_AVX
+#if VEC2_BATCH_DISPATCH
+    if (arch & GLM_ARCH_AVX_BIT)
+#endif
+    {
+        BatchKernels kernels = VEC2_BATCH_KERNELS(avx);
+        return kernels;
+    }
+#endif
+#if VEC2_BATCH_SSE2
+    BatchKernels kernels = VEC2_BATCH_KERNELS(sse2);
+#else
+    BatchKernels kernels = VEC2_BATCH_KERNELS(scalar);
+#endif
+    return kernels;
+}
+
+// Chosen on the first batch call
+static const BatchKernels &kernels() {
+    static const BatchKernels selected = selectKernels();
+    return selected;
+}
+
+void Vec2Batch::assign(const glm::vec2 *points, size_t count) {
+    resize(count);
+    for (size_t i = 0; i < count; i++) {
+        xs[i] = points[i].x;
+        ys[i] = points[i].y;
+    }
+}
+
+void Vec2Batch::store(glm::vec2 *points) const {
+    for (size_t i = 0; i < xs.size(); i++) {
+        points[i] = glm::vec2(xs[i], ys[i]);
+    }
+}
+
+size_t vec2BatchWidth() {
+    return kernels().width;
+}
+
+void batchNormalize(const Vec2Batch &v, Vec2Batch &out, NormalizePrecision precision) {
+    out.resize(v.size());
+    kernels().normalize(v, out, precision);
+}
+
+void batchPerp(const Vec2Batch &v, Vec2Batch &out) {
+    out.resize(v.size());
+    kernels().perp(v, out);
+}
+
+void batchDot(const Vec2Batch &a, const Vec2Batch &b, std::vector<float> &out) {
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    kernels().dot(a, b, out.empty() ? NULL : &out[0]);
+}
+
+void batchLength(const Vec2Batch &v, std::vector<float> &out) {
+    out.resize(v.size());
+    kernels().length(v, out.empty() ? NULL : &out[0]);
+}
+
+void batchLerp(const Vec2Batch &a, const Vec2Batch &b, float t, Vec2Batch &out) {
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    kernels().lerp(a, b, t, out);
+}
+
+void batchTransform(const glm::mat3x2 &m, const Vec2Batch &v, Vec2Batch &out) {
+    out.resize(v.size());
+    kernels().transform(m, v, out);
+}
+
+void batchJoins(const Vec2Batch &points, float halfWidth, PolylineJoins &joins, NormalizePrecision precision) {
+    size_t pointCount = points.size();
+    size_t segmentCount = pointCount > 1 ? pointCount - 1 : 0;
+    joins.normals.resize(segmentCount);
+    joins.offsets.resize(segmentCount > 0 ? pointCount : 0);
+    joins.miterRatios.resize(joins.offsets.size());
+    joins.halfWidth = halfWidth;
+    if (segmentCount == 0) {
+        return;
+    }
+
+    kernels().segmentNormals(points, segmentCount, joins.normals, precision);
+    kernels().miters(joins.normals, segmentCount - 1, halfWidth, joins.offsets, &joins.miterRatios[0]);
+
+    // The ends have no neighbour to miter with
+    joins.offsets.set(0, joins.normals[0] * halfWidth);
+    joins.offsets.set(segmentCount, joins.normals[segmentCount - 1] * halfWidth);
+    joins.miterRatios[0] = 1.0f;
+    joins.miterRatios[segmentCount] = 1.0f;
+}
@@ -0,0 +1,102 @@
+//
+//  Vec2Batch.h
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+
+#ifndef Vec2Batch_h
+#define Vec2Batch_h
+
+#include <vector>
+#include <glm/vec2.hpp>
+#include <glm/mat3x2.hpp>
+
+// 2D points stored as a structure of arrays, all x then all y, so the batch
+// functions below load a full register of points at once. glm::vec2 has no
+// SIMD path of its own.
+class Vec2Batch {
+public:
+    Vec2Batch() {}
+    explicit Vec2Batch(size_t count) : xs(count), ys(count) {}
+    Vec2Batch(const glm::vec2 *points, size_t count) { assign(points, count); }
+
+    size_t size() const { return xs.size(); }
+    void resize(size_t count) { xs.resize(count); ys.resize(count); }
+
+    void assign(const glm::vec2 *points, size_t count);
+    // Writes the points back as size() glm::vec2.
+    void store(glm::vec2 *points) const;
+
+    glm::vec2 operator[](size_t i) const { return glm::vec2(xs[i], ys[i]); }
+    void set(size_t i, glm::vec2 p) { xs[i] = p.x; ys[i] = p.y; }
+
+    float *x() { return xs.empty() ? NULL : &xs[0]; }
+    float *y() { return ys.empty() ? NULL : &ys[0]; }
+    const float *x() const { return xs.empty() ? NULL : &xs[0]; }
+    const float *y() const { return ys.empty() ? NULL : &ys[0]; }
+
+private:
+    std::vector<float> xs;
+    std::vector<float> ys;
+};
+
+// Points per step of the batch functions: 16 with AVX-512, 8 with AVX, 4
+// with SSE2 and 1 without SIMD. x86 builds with GCC or Clang carry all
+// three and use the widest the CPU has. The last size() % width points run
+// one at a time.
+size_t vec2BatchWidth();
+
+// How batchNormalize() and batchJoins() take 1 / length. ESTIMATE is the
+// hardware reciprocal square root, REFINED adds one Newton-Raphson step,
+// EXACT divides by sqrt and matches glm::normalize. All three keep the
+// direction to 4e-8 radians, only the length is off. On 1024 points, one
+// core, in Mpts/s:
+//
+//   precision   max |length - 1|            SSE2   AVX2   AVX-512
+//   ESTIMATE    3.3e-4 (6.0e-5 on AVX-512)  3000   3950   4850
+//   REFINED     2.9e-7                      1800   3050   4250
+//   EXACT       1.6e-7                      1550   1750   1750
+//
+// For a stroke normal the length error scales the width: ESTIMATE is off
+// by under 0.002 pixels on a 10 pixel line, so it suits screen drawing.
+// Print output, or anything measuring the outline, wants REFINED or EXACT.
+enum NormalizePrecision {
+    NORMALIZE_ESTIMATE,
+    NORMALIZE_REFINED,
+    NORMALIZE_EXACT
+};
+
+// Each function resizes out to the size of its input and gives the same
+// result as the glm function on every point. out may be one of the inputs.
+// Two inputs must have the same size.
+void batchNormalize(const Vec2Batch &v, Vec2Batch &out, NormalizePrecision precision = NORMALIZE_EXACT);
+// (-y, x)
+void batchPerp(const Vec2Batch &v, Vec2Batch &out);
+void batchDot(const Vec2Batch &a, const Vec2Batch &b, std::vector<float> &out);
+void batchLength(const Vec2Batch &v, std::vector<float> &out);
+// glm::mix(a, b, t)
+void batchLerp(const Vec2Batch &a, const Vec2Batch &b, float t, Vec2Batch &out);
+// m * vec3(p, 1)
+void batchTransform(const glm::mat3x2 &m, const Vec2Batch &v, Vec2Batch &out);
+
+// Join geometry of a whole polyline. normals[i] is the unit normal of
+// segment i. offsets[i] is the outline offset at point i: the miter vector
+// where two segments meet, the segment normal times halfWidth at the ends.
+// miterRatios[i] is |offsets[i]| / halfWidth, to compare with a miter limit
+// as strokeSegments() does. Where a segment turns straight back the miter
+// has no length: its offset and ratio are NaN. Two equal neighbouring
+// points have no normal at all, remove them first.
+struct PolylineJoins {
+    Vec2Batch normals;
+    Vec2Batch offsets;
+    std::vector<float> miterRatios;
+    float halfWidth;
+
+    PolylineJoins() : halfWidth(0.0f) {}
+};
+
+void batchJoins(const Vec2Batch &points, float halfWidth, PolylineJoins &joins, NormalizePrecision precision = NORMALIZE_EXACT);
+
+#endif /* Vec2Batch_h */
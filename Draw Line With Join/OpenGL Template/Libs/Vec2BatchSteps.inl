@@ -0,0 +1,215 @@
+//
+//  Vec2BatchSteps.inl
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+
+// The batch kernels, written once against WideLanes and TailLanes.
+// Vec2Batch.cpp includes this in one namespace per instruction set, each
+// compiled for its own target, and picks one of them at run time.
+
+// Runs step for every index in [0, count), WideLanes::width at a time, the
+// rest with TailLanes.
+template<typename Step>
+static void forEachLane(size_t count, const Step &step) {
+    size_t i = 0;
+    for (; i + WideLanes::width <= count; i += WideLanes::width) {
+        step.template run<WideLanes>(i);
+    }
+    for (; i < count; i++) {
+        step.template run<TailLanes>(i);
+    }
+}
+
+// 1 / sqrt(a) at each NormalizePrecision
+template<NormalizePrecision P> struct InverseSqrt;
+
+template<> struct InverseSqrt<NORMALIZE_ESTIMATE> {
+    template<typename L> static typename L::type run(typename L::type a) {
+        return L::rsqrt(a);
+    }
+};
+
+// One Newton-Raphson step: y * (1.5 - 0.5 * a * y * y)
+template<> struct InverseSqrt<NORMALIZE_REFINED> {
+    template<typename L> static typename L::type run(typename L::type a) {
+        typename L::type y = L::rsqrt(a);
+        typename L::type ayy = L::mul(L::mul(a, y), y);
+        return L::mul(y, L::sub(L::set(1.5f), L::mul(L::set(0.5f), ayy)));
+    }
+};
+
+template<> struct InverseSqrt<NORMALIZE_EXACT> {
+    template<typename L> static typename L::type run(typename L::type a) {
+        return L::div(L::set(1.0f), L::sqrt(a));
+    }
+};
+
+template<NormalizePrecision P>
+struct NormalizeStep {
+    const float *x, *y;
+    float *outX, *outY;
+
+    template<typename L> void run(size_t i) const {
+        typename L::type vx = L::load(x + i);
+        typename L::type vy = L::load(y + i);
+        typename L::type inv = InverseSqrt<P>::template run<L>(L::add(L::mul(vx, vx), L::mul(vy, vy)));
+        L::store(outX + i, L::mul(vx, inv));
+        L::store(outY + i, L::mul(vy, inv));
+    }
+};
+
+struct PerpStep {
+    const float *x, *y;
+    float *outX, *outY;
+
+    template<typename L> void run(size_t i) const {
+        typename L::type vx = L::load(x + i);
+        typename L::type vy = L::load(y + i);
+        L::store(outX + i, L::neg(vy));
+        L::store(outY + i, vx);
+    }
+};
+
+struct DotStep {
+    const float *ax, *ay, *bx, *by;
+    float *out;
+
+    template<typename L> void run(size_t i) const {
+        L::store(out + i, L::add(L::mul(L::load(ax + i), L::load(bx + i)), L::mul(L::load(ay + i), L::load(by + i))));
+    }
+};
+
+struct LengthStep {
+    const float *x, *y;
+    float *out;
+
+    template<typename L> void run(size_t i) const {
+        typename L::type vx = L::load(x + i);
+        typename L::type vy = L::load(y + i);
+        L::store(out + i, L::sqrt(L::add(L::mul(vx, vx), L::mul(vy, vy))));
+    }
+};
+
+struct LerpStep {
+    const float *ax, *ay, *bx, *by;
+    float t;
+    float *outX, *outY;
+
+    template<typename L> void run(size_t i) const {
+        typename L::type u = L::set(t);
+        typename L::type vx = L::load(ax + i);
+        typename L::type vy = L::load(ay + i);
+        L::store(outX + i, L::add(vx, L::mul(u, L::sub(L::load(bx + i), vx))));
+        L::store(outY + i, L::add(vy, L::mul(u, L::sub(L::load(by + i), vy))));
+    }
+};
+
+struct TransformStep {
+    glm::mat3x2 m;
+    const float *x, *y;
+    float *outX, *outY;
+
+    template<typename L> void run(size_t i) const {
+        typename L::type vx = L::load(x + i);
+        typename L::type vy = L::load(y + i);
+        L::store(outX + i, L::add(L::add(L::mul(L::set(m[0][0]), vx), L::mul(L::set(m[1][0]), vy)), L::set(m[2][0])));
+        L::store(outY + i, L::add(L::add(L::mul(L::set(m[0][1]), vx), L::mul(L::set(m[1][1]), vy)), L::set(m[2][1])));
+    }
+};
+
+// Unit normal of the segment from point i to point i + 1
+template<NormalizePrecision P>
+struct SegmentNormalStep {
+    const float *x, *y;
+    float *outX, *outY;
+
+    template<typename L> void run(size_t i) const {
+        typename L::type dx = L::sub(L::load(x + i + 1), L::load(x + i));
+        typename L::type dy = L::sub(L::load(y + i + 1), L::load(y + i));
+        typename L::type inv = InverseSqrt<P>::template run<L>(L::add(L::mul(dx, dx), L::mul(dy, dy)));
+        L::store(outX + i, L::neg(L::mul(dy, inv)));
+        L::store(outY + i, L::mul(dx, inv));
+    }
+};
+
+// Miter at point i + 1, between segments i and i + 1. joinNormal is not
+// normalized, dividing by its projection on the second normal gives the
+// miter length.
+struct MiterStep {
+    const float *nx, *ny;
+    float halfWidth;
+    float *outX, *outY, *outRatio;
+
+    template<typename L> void run(size_t i) const {
+        typename L::type n2x = L::load(nx + i + 1);
+        typename L::type n2y = L::load(ny + i + 1);
+        typename L::type jx = L::add(L::load(nx + i), n2x);
+        typename L::type jy = L::add(L::load(ny + i), n2y);
+        typename L::type cosHalfAngle = L::add(L::mul(n2x, jx), L::mul(n2y, jy));
+        typename L::type scale = L::div(L::set(halfWidth), cosHalfAngle);
+        L::store(outX + i + 1, L::mul(jx, scale));
+        L::store(outY + i + 1, L::mul(jy, scale));
+        L::store(outRatio + i + 1, L::div(L::sqrt(L::add(L::mul(jx, jx), L::mul(jy, jy))), cosHalfAngle));
+    }
+};
+
+template<NormalizePrecision P>
+static void normalizeWith(const Vec2Batch &v, Vec2Batch &out) {
+    NormalizeStep<P> step = { v.x(), v.y(), out.x(), out.y() };
+    forEachLane(v.size(), step);
+}
+
+static void normalize(const Vec2Batch &v, Vec2Batch &out, NormalizePrecision precision) {
+    switch (precision) {
+        case NORMALIZE_ESTIMATE: normalizeWith<NORMALIZE_ESTIMATE>(v, out); break;
+        case NORMALIZE_REFINED: normalizeWith<NORMALIZE_REFINED>(v, out); break;
+        case NORMALIZE_EXACT: normalizeWith<NORMALIZE_EXACT>(v, out); break;
+    }
+}
+
+static void perp(const Vec2Batch &v, Vec2Batch &out) {
+    PerpStep step = { v.x(), v.y(), out.x(), out.y() };
+    forEachLane(v.size(), step);
+}
+
+static void dot(const Vec2Batch &a, const Vec2Batch &b, float *out) {
+    DotStep step = { a.x(), a.y(), b.x(), b.y(), out };
+    forEachLane(a.size(), step);
+}
+
+static void length(const Vec2Batch &v, float *out) {
+    LengthStep step = { v.x(), v.y(), out };
+    forEachLane(v.size(), step);
+}
+
+static void lerp(const Vec2Batch &a, const Vec2Batch &b, float t, Vec2Batch &out) {
+    LerpStep step = { a.x(), a.y(), b.x(), b.y(), t, out.x(), out.y() };
+    forEachLane(a.size(), step);
+}
+
+static void transform(const glm::mat3x2 &m, const Vec2Batch &v, Vec2Batch &out) {
+    TransformStep step = { m, v.x(), v.y(), out.x(), out.y() };
+    forEachLane(v.size(), step);
+}
+
+template<NormalizePrecision P>
+static void segmentNormalsWith(const Vec2Batch &points, size_t segmentCount, Vec2Batch &normals) {
+    SegmentNormalStep<P> step = { points.x(), points.y(), normals.x(), normals.y() };
+    forEachLane(segmentCount, step);
+}
+
+static void segmentNormals(const Vec2Batch &points, size_t segmentCount, Vec2Batch &normals, NormalizePrecision precision) {
+    switch (precision) {
+        case NORMALIZE_ESTIMATE: segmentNormalsWith<NORMALIZE_ESTIMATE>(points, segmentCount, normals); break;
+        case NORMALIZE_REFINED: segmentNormalsWith<NORMALIZE_REFINED>(points, segmentCount, normals); break;
+        case NORMALIZE_EXACT: segmentNormalsWith<NORMALIZE_EXACT>(points, segmentCount, normals); break;
+    }
+}
+
+static void miters(const Vec2Batch &normals, size_t jointCount, float halfWidth, Vec2Batch &offsets, float *ratios) {
+    MiterStep step = { normals.x(), normals.y(), halfWidth, offsets.x(), offsets.y(), ratios };
+    forEachLane(jointCount, step);
+}
@@ -4,14 +4,21 @@
 #include <OpenGL/gl3.h>
 
 #include <stdio.h>
+#include <stddef.h>
 #include <string>
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <chrono>
+#include <thread>
+#include <memory>
 #include <unistd.h>
 #include <errno.h>
 
 #include "GLUtil.h"
+#include "ShaderLibrary.h"
+#include "Stroker.h"
+#include "Loader.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/vec2.hpp>
@@ -20,57 +27,134 @@
 #include <glm/mat4x4.hpp> // glm::mat4
 #include <glm/gtc/matrix_transform.hpp> // glm::translate, glm::rotate, glm::scale, glm::perspective
 #include <glm/gtc/constants.hpp> // glm::pi
-
-// Vertice shader
-const char * VERTEX_SHADER = R"SHADER(
-#version 330 core
-
-layout(location = 0) in vec4 vPosition;
-in vec2 a_Normal;
-
-out vec2 vNormal;
-
-uniform float u_lineWidth;
-uniform mat4 modelView;
-uniform mat4 project;
-
-void
-main(){
-    float lineWidth = u_lineWidth + 1.0;
-    vec4 pos = project * modelView * vec4(vPosition.xy / 1.0, 0, 1);
-    gl_Position = pos;
-    vNormal = a_Normal;
-}
-)SHADER";
-
-// Fragment shader
-const char * FRAGMENT_SHADER = R"SHADER(
-#version 330 core
-
-#define feather 1.0
-
-in vec2 vNormal;
-out vec4 fColor;
-
-uniform float u_lineWidth;
-void
-main(){
-    float lineWidth = u_lineWidth + 0.5;
-    float dist = length(vNormal) * lineWidth;
-    float alpha = dist < lineWidth - feather - feather? 1.0 :clamp(((lineWidth - dist) / feather / 2.0) , 0.0, 1.0);
-    fColor = vec4(0.0, 0.0, 0.0, alpha);
-}
-)SHADER";
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/affine_2d.hpp> // glm::affineOrtho
+#include <glm/gtx/random_stream.hpp> // glm::linearRand
 
 const float lineWidth = 4.0 + 1.0;
+const float feather = 1.0;
 
 //Screen dimension constants
 const int SCREEN_WIDTH = 640;
 
 const int SCREEN_HEIGHT = 480;
 
-GLuint program;
-GLuint vertexbuffer;
+// Screen coordinates to clip space, y down. Built at compile time, the
+// corners checked below.
+constexpr glm::mat3x2 SCREEN_TO_CLIP = glm::affineOrtho(0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0.0f);
+static_assert(SCREEN_TO_CLIP[2].x == -1.0f && SCREEN_TO_CLIP[2].y == 1.0f, "top left corner is not (-1, 1)");
+constexpr glm::vec2 SCREEN_BOTTOM_RIGHT = SCREEN_TO_CLIP * glm::vec3(SCREEN_WIDTH, SCREEN_HEIGHT, 1);
+static_assert(SCREEN_BOTTOM_RIGHT.x == 1.0f && SCREEN_BOTTOM_RIGHT.y == -1.0f, "bottom right corner is not (1, -1)");
+#if GLM_ARCH == GLM_ARCH_PURE
+// mat4 and vec4 are only literal types without SIMD. The same transform
+// from ortho, and from translate times scale, must agree with it.
+constexpr glm::mat4 SCREEN_ORTHO = glm::ortho(0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0.0f);
+constexpr glm::mat4 SCREEN_TRANSLATE_SCALE = glm::translate(glm::mat4(1.0f), glm::vec3(-1.0f, 1.0f, 0.0f)) * glm::scale(glm::mat4(1.0f), glm::vec3(2.0f / SCREEN_WIDTH, -2.0f / SCREEN_HEIGHT, 1.0f));
+static_assert(SCREEN_ORTHO[0][0] == SCREEN_TO_CLIP[0][0] && SCREEN_ORTHO[1][1] == SCREEN_TO_CLIP[1][1] && SCREEN_ORTHO[3][0] == SCREEN_TO_CLIP[2][0] && SCREEN_ORTHO[3][1] == SCREEN_TO_CLIP[2][1], "ortho differs from affineOrtho");
+static_assert(SCREEN_TRANSLATE_SCALE[0][0] == SCREEN_ORTHO[0][0] && SCREEN_TRANSLATE_SCALE[1][1] == SCREEN_ORTHO[1][1] && SCREEN_TRANSLATE_SCALE[3][0] == SCREEN_ORTHO[3][0] && SCREEN_TRANSLATE_SCALE[3][1] == SCREEN_ORTHO[3][1], "translate * scale differs from ortho");
+constexpr glm::vec4 SCREEN_ORTHO_BOTTOM_RIGHT = SCREEN_ORTHO * glm::vec4(SCREEN_WIDTH, SCREEN_HEIGHT, 0, 1);
+static_assert(SCREEN_ORTHO_BOTTOM_RIGHT[0] == 1.0f && SCREEN_ORTHO_BOTTOM_RIGHT[1] == -1.0f, "bottom right corner is not (1, -1)");
+#endif
+
+// Double-buffered vertex batches: a new tessellation is written into the
+// buffer the GPU is not drawing from, then the two are swapped.
+GLuint vertexbuffers[2];
+int currentBatch = 0;
+GLsizei vertexCount = 0;
+
+// Whether the current batch holds PackedStrokeVertex, and the tile of its
+// positions
+bool batchPacked = false;
+StrokeTile batchTile;
+
+// The same points, padded for the instanced stroke shader
+GLuint pointbuffers[2];
+GLsizei segmentCount = 0;
+
+// And once more as they are, in a texture buffer the pulled stroke
+// shader reads by gl_VertexID
+GLuint pulledbuffers[2];
+GLuint pointtextures[2];
+
+// Where the stroke is expanded: on the CPU, on the GPU with one instance
+// per segment, from points the vertex shader fetches itself, or in a
+// geometry shader fed the padded points as a line strip with adjacency
+enum ExpandMode {
+    EXPAND_CPU,
+    EXPAND_INSTANCED,
+    EXPAND_PULLED,
+    EXPAND_GEOMETRY,
+    EXPAND_MODE_COUNT
+};
+
+const char *EXPAND_MODE_NAMES[EXPAND_MODE_COUNT] = { "cpu", "instanced", "pulled", "geometry" };
+
+// Draws of each mode benchmarkModes() times
+const int BENCHMARK_DRAWS = 50;
+
+ExpandMode gMode = EXPAND_CPU;
+ShaderJoin gJoin = JOIN_MITER;
+ShaderCap gCap = CAP_BUTT;
+
+// Blend in linear space through an sRGB framebuffer. The white background
+// and black stroke read the same either way, only the coverage ramp of
+// the edges changes.
+bool gSRGB = false;
+
+// Stroke the Catmull-Rom spline through the points on the CPU path. The
+// instanced path keeps drawing the polyline.
+bool gSmooth = false;
+std::vector<glm::vec2> gPoints;
+
+// Whether points were rewritten in the pulled texture buffer only
+bool gPulledEdits = false;
+
+// Counts every change of the points drawn, swapped in batches and pulled
+// edits alike
+int strokeVersion = 0;
+
+// Cache the instanced and pulled expansion with transform feedback: the
+// expanded vertices are captured into capturebuffer once and drawn from
+// there until the points, width, join, cap or mode change.
+bool gCapture = false;
+GLuint capturebuffer = 0;
+GLsizeiptr captureCapacity = 0;
+
+// What the captured vertices were expanded from, version -1 for nothing
+struct CaptureSource {
+    int version;
+    float lineWidth;
+    unsigned keyBits;
+    GLsizei vertexCount;
+};
+CaptureSource gCaptured = { -1, 0.0f, 0, 0 };
+
+// Upload PackedStrokeVertex instead of StrokeVertex, half the memory
+bool gPacked = false;
+
+// Stroke a long random walk instead of three points, to measure the
+// vertex formats on a scene with many vertices
+bool gLargeScene = false;
+const size_t LARGE_SCENE_POINTS = 200000;
+
+// GPU time of the frames, printed every TIMED_FRAMES frames of the large
+// scene
+GpuTimer *gTimer = NULL;
+const size_t TIMED_FRAMES = 120;
+
+StrokeTessellator *gTessellator = NULL;
+
+//Uploads geometry on its own thread and GL context
+BackgroundLoader *gLoader = NULL;
+bool uploadInFlight = false;
+bool hasQueuedPoints = false;
+std::vector<glm::vec2> queuedPoints;
+
+//The window we'll be rendering to
+SDL_Window* gWindow = NULL;
+
+//OpenGL context
+SDL_GLContext gContext;
 
 glm::vec2 perp(glm::vec2 p) {
     float ty = p[1];
@@ -90,61 +174,154 @@ glm::vec2 mult(glm::vec2 p, float m) {
     return glm::vec2(p[0] * m, p[1] * m);
 }
 
+// Tessellates into buffer, packed positions relative to *tile. Runs on
+// the loader thread with the shared context current.
+size_t uploadStroke(const std::vector<glm::vec2> &points, GLuint buffer, bool smooth, bool packed, StrokeTile *tile){
+    size_t count = smooth ? gTessellator->tessellateSmooth(points, lineWidth) : gTessellator->tessellate(points, lineWidth);
+    GLsizeiptr size = count * (packed ? sizeof(PackedStrokeVertex) : sizeof(StrokeVertex));
+    *tile = gTessellator->tile();
+
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+    if (size > 0) {
+        void *dst = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (packed) {
+            gTessellator->stitchPacked((PackedStrokeVertex *)dst, *tile);
+        } else {
+            gTessellator->stitch((StrokeVertex *)dst);
+        }
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+
+    return count;
+}
+
+// Uploads the points with the first and last repeated, so instance i reads
+// its previous, start, end and next point from i to i + 3.
+void uploadPoints(const std::vector<glm::vec2> &points, GLuint buffer){
+    std::vector<glm::vec2> padded;
+    if (!points.empty()) {
+        padded.reserve(points.size() + 2);
+        padded.push_back(points.front());
+        padded.insert(padded.end(), points.begin(), points.end());
+        padded.push_back(points.back());
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, padded.size() * sizeof(glm::vec2), padded.empty() ? NULL : &padded[0], GL_DYNAMIC_DRAW);
+}
+
+// Uploads the points once each, to the texture buffer behind buffer.
+void uploadPulledPoints(const std::vector<glm::vec2> &points, GLuint buffer){
+    glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+    glBufferData(GL_TEXTURE_BUFFER, points.size() * sizeof(glm::vec2), points.empty() ? NULL : &points[0], GL_DYNAMIC_DRAW);
+}
+
+// Streams a new stroke into the back batch. The front batch keeps being
+// drawn until the loader's fence signals, then the two are swapped. Only
+// one upload is in flight; newer points wait for it and replace each other.
+void loadStroke(const std::vector<glm::vec2> &points){
+    if (uploadInFlight) {
+        queuedPoints = points;
+        hasQueuedPoints = true;
+        return;
+    }
+    uploadInFlight = true;
+
+    int batch = 1 - currentBatch;
+    GLuint buffer = vertexbuffers[batch];
+    std::shared_ptr<size_t> count(new size_t(0));
+
+    GLuint pointBuffer = pointbuffers[batch];
+    GLuint pulledBuffer = pulledbuffers[batch];
+    GLsizei segments = points.size() > 1 ? (GLsizei)points.size() - 1 : 0;
+    bool smooth = gSmooth;
+    bool packed = gPacked;
+    std::shared_ptr<StrokeTile> tile(new StrokeTile());
+
+    gLoader->enqueue([points, buffer, pointBuffer, pulledBuffer, count, smooth, packed, tile] {
+        *count = uploadStroke(points, buffer, smooth, packed, tile.get());
+        uploadPoints(points, pointBuffer);
+        uploadPulledPoints(points, pulledBuffer);
+    }, [batch, count, segments, packed, tile] {
+        currentBatch = batch;
+        vertexCount = (GLsizei)*count;
+        segmentCount = segments;
+        batchPacked = packed;
+        batchTile = *tile;
+        strokeVersion++;
+        uploadInFlight = false;
+        printf("%d vertices, %zu KB\n", vertexCount, *count * (packed ? sizeof(PackedStrokeVertex) : sizeof(StrokeVertex)) / 1024);
+
+        if (hasQueuedPoints) {
+            hasQueuedPoints = false;
+            loadStroke(queuedPoints);
+        }
+    });
+}
+
+// The three points of the demo, or a random walk of LARGE_SCENE_POINTS
+// points, the same on every run. The walk turns by at most 0.6 radians a
+// point and steers back near the edges of the screen. The CPU path bevels
+// sharper turns, the GPU paths have no miter limit and would grow miters
+// far past the screen.
+std::vector<glm::vec2> scenePoints(bool large){
+    std::vector<glm::vec2> points;
+    if (!large) {
+        points.push_back(glm::vec2(50, 20));
+        points.push_back(glm::vec2(120, 190));
+        points.push_back(glm::vec2(200, 20));
+        return points;
+    }
+
+    std::vector<float> turns(LARGE_SCENE_POINTS);
+    glm::randomStream stream(1);
+    glm::linearRand(stream, -0.3f, 0.3f, &turns[0], LARGE_SCENE_POINTS);
+
+    const float margin = 20.0f;
+    glm::vec2 size(SCREEN_WIDTH, SCREEN_HEIGHT);
+    glm::vec2 p = size * 0.5f;
+    float heading = 0.0f;
+    points.resize(LARGE_SCENE_POINTS);
+    for (size_t i = 0; i < LARGE_SCENE_POINTS; i++) {
+        glm::vec2 direction(cos(heading), sin(heading));
+        if (glm::any(glm::lessThan(p, glm::vec2(margin))) || glm::any(glm::greaterThan(p, size - margin))) {
+            glm::vec2 toCenter = size * 0.5f - p;
+            heading += direction.x * toCenter.y - direction.y * toCenter.x > 0.0f ? 0.3f : -0.3f;
+        }
+        heading += turns[i];
+        p += glm::vec2(cos(heading), sin(heading)) * 3.0f;
+        points[i] = p;
+    }
+    return points;
+}
+
 void initVertices(){
     GLuint VertexArrayID;
     glGenVertexArrays(1, &VertexArrayID);
     glBindVertexArray(VertexArrayID);
 
-    // Create and compile our GLSL program from the shaders
-    program = LoadShaders(VERTEX_SHADER, FRAGMENT_SHADER);
-
     // Line points
-    glm::vec2 p1 = glm::vec2(50, 20);
-    glm::vec2 p2 = glm::vec2(120, 190);
-    glm::vec2 p3 = glm::vec2(200, 20);
-
-    glm::vec2 cwNormal_p1p2 = perp(glm::normalize(p2 - p1));
-    glm::vec2 ccwNormal_p1p2 = cwNormal_p1p2 * glm::vec2(-1.0);
-
-    glm::vec2 cwNormal_p2p3 = perp(glm::normalize(p3 - p2));
-    glm::vec2 ccwNormal_p2p3 =  cwNormal_p2p3 * glm::vec2(-1.0);
-
-    glm::vec2 joinNormal = cwNormal_p1p2 + cwNormal_p2p3;
-    float cosHalfAngle = (cwNormal_p2p3[0] * joinNormal[0]) + (cwNormal_p2p3[1] * joinNormal[1]);
-    float miterLengthRatio = 1 / cosHalfAngle;
-
-    // Calculate 6 points to form 2 lines
-    glm::vec2 startPoint1 = p1 + (cwNormal_p1p2 * glm::vec2(lineWidth / 2.0));
-    glm::vec2 startPoint2 = p1 + (ccwNormal_p1p2 * glm::vec2(lineWidth / 2.0));
-    glm::vec2 miterVector = joinNormal * glm::vec2(miterLengthRatio * lineWidth / 2.0);
-    glm::vec2 extrudePointUp = p2 + miterVector;
-    glm::vec2 extrudePointDown = p2 + (miterVector * glm::vec2(-1.0));
-    glm::vec2 endPoint1 = p3 + (cwNormal_p2p3 * glm::vec2(lineWidth / 2.0));
-    glm::vec2 endPoint2 = p3 + (ccwNormal_p2p3 * glm::vec2(lineWidth / 2.0));
-
-
-    static const GLfloat g_vertex_buffer_data[] = {
-        // Line 1
-        startPoint1[0], startPoint1[1], cwNormal_p1p2[0], cwNormal_p1p2[1],
-        startPoint2[0], startPoint2[1], ccwNormal_p1p2[0], ccwNormal_p1p2[1],
-        extrudePointDown[0], extrudePointDown[1], ccwNormal_p1p2[0], ccwNormal_p1p2[1],
-        extrudePointDown[0], extrudePointDown[1], ccwNormal_p1p2[0], ccwNormal_p1p2[1],
-        extrudePointUp[0], extrudePointUp[1], cwNormal_p1p2[0], cwNormal_p1p2[1],
-        startPoint1[0], startPoint1[1], cwNormal_p1p2[0], cwNormal_p1p2[1],
-
-        // Line 2
-        endPoint1[0], endPoint1[1], cwNormal_p2p3[0], cwNormal_p2p3[1],
-        endPoint2[0], endPoint2[1], ccwNormal_p2p3[0], ccwNormal_p2p3[1],
-        extrudePointDown[0], extrudePointDown[1], ccwNormal_p2p3[0], ccwNormal_p2p3[1],
-        extrudePointDown[0], extrudePointDown[1], ccwNormal_p2p3[0], ccwNormal_p2p3[1],
-        extrudePointUp[0], extrudePointUp[1], cwNormal_p2p3[0], cwNormal_p2p3[1],
-        endPoint1[0], endPoint1[1], cwNormal_p2p3[0], cwNormal_p2p3[1]
-    };
+    std::vector<glm::vec2> points = scenePoints(false);
 
-    glGenBuffers(1, &vertexbuffer);
-    glBindBuffer(GL_ARRAY_BUFFER, vertexbuffer);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(g_vertex_buffer_data), g_vertex_buffer_data, GL_STATIC_DRAW);
+    unsigned threads = std::thread::hardware_concurrency();
+    gTessellator = new StrokeTessellator(threads > 0 ? threads : 1);
 
+    glGenBuffers(2, vertexbuffers);
+    glGenBuffers(2, pointbuffers);
+    glGenBuffers(1, &capturebuffer);
+
+    glGenBuffers(2, pulledbuffers);
+    glGenTextures(2, pointtextures);
+    for (int i = 0; i < 2; i++) {
+        glBindBuffer(GL_TEXTURE_BUFFER, pulledbuffers[i]);
+        glBindTexture(GL_TEXTURE_BUFFER, pointtextures[i]);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RG32F, pulledbuffers[i]);
+    }
+    gLoader = new BackgroundLoader(gWindow, gContext);
+    gTimer = new GpuTimer();
+    gPoints = points;
+    loadStroke(points);
 }
 // End Red book
 
@@ -164,15 +341,12 @@ void update();
 //Renders quad to the screen
 void render();
 
+//Times every stroke expansion mode
+void benchmarkModes();
+
 //Frees media and shuts down SDL
 void close();
 
-//The window we'll be rendering to
-SDL_Window* gWindow = NULL;
-
-//OpenGL context
-SDL_GLContext gContext;
-
 //Render flag
 bool gRender= true;
 
@@ -196,6 +370,9 @@ bool init(){
         //SDL_GL_SetAttribute(SDL_GL_MULTISAMPLEBUFFERS,1);
         //SDL_GL_SetAttribute(SDL_GL_MULTISAMPLESAMPLES,4);
 
+        // Lets 's' switch to linear blending
+        SDL_GL_SetAttribute(SDL_GL_FRAMEBUFFER_SRGB_CAPABLE, 1);
+
         //Create window
         gWindow = SDL_CreateWindow("Draw Antialiasing Line", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_OPENGL | SDL_WINDOW_SHOWN);
         if(gWindow == NULL){
@@ -251,77 +428,398 @@ bool initGL()
     return success;
 }
 
+// Moves the middle point up or down. The pulled stroke only needs that
+// point rewritten in its texture buffer, the other modes expand the whole
+// stroke again, and do so once the mode changes after pulled edits.
+void wiggle(){
+    size_t middle = gPoints.size() / 2;
+    gPoints[middle].y += gPoints[middle].y > SCREEN_HEIGHT / 2 ? -40.0f : 40.0f;
+
+    if (gMode != EXPAND_PULLED || uploadInFlight) {
+        loadStroke(gPoints);
+        return;
+    }
+
+    glBindBuffer(GL_TEXTURE_BUFFER, pulledbuffers[currentBatch]);
+    glBufferSubData(GL_TEXTURE_BUFFER, middle * sizeof(glm::vec2), sizeof(glm::vec2), &gPoints[middle]);
+    gPulledEdits = true;
+    strokeVersion++;
+}
+
 void handleKeys(unsigned char key, int x, int y){
     //Toggle quad
     if(key == 'q'){
         gRender = !gRender;
     }
+    //Cycle CPU, instanced, pulled and geometry shader stroke expansion
+    if(key == 'i'){
+        gMode = (ExpandMode)((gMode + 1) % EXPAND_MODE_COUNT);
+        if (gPulledEdits) {
+            gPulledEdits = false;
+            loadStroke(gPoints);
+        }
+    }
+    //Move the middle point
+    if(key == 'w'){
+        wiggle();
+    }
+    //Time every expansion mode on the current stroke
+    if(key == 'b'){
+        benchmarkModes();
+    }
+    //Cycle joins and caps of the instanced stroke
+    if(key == 'j'){
+        gJoin = (ShaderJoin)((gJoin + 1) % 3);
+    }
+    if(key == 'c'){
+        gCap = (ShaderCap)((gCap + 1) % 3);
+    }
+    //Toggle blending in linear space
+    if(key == 's'){
+        gSRGB = SetSRGBFramebuffer(!gSRGB);
+        printf("sRGB framebuffer %s\n", gSRGB ? "on" : "off");
+    }
+    //Toggle the smoothed stroke
+    if(key == 'm'){
+        gSmooth = !gSmooth;
+        loadStroke(gPoints);
+    }
+    //Toggle packed vertices
+    if(key == 'p'){
+        gPacked = !gPacked;
+        printf("%s vertices\n", gPacked ? "Packed" : "Float");
+        loadStroke(gPoints);
+    }
+    //Toggle the transform feedback cache
+    if(key == 'f'){
+        gCapture = !gCapture;
+        printf("Transform feedback cache %s\n", gCapture ? "on" : "off");
+    }
+    //Toggle the large scene
+    if(key == 'l'){
+        gLargeScene = !gLargeScene;
+        gPoints = scenePoints(gLargeScene);
+        loadStroke(gPoints);
+    }
 }
 
 void update(){
     //No per frame update needed
 }
 
-void render(){
-    if (!gRender) {
-        // Clear the screen
-        glClear(GL_COLOR_BUFFER_BIT);
-        return ;
+// Draws the current batch of PackedStrokeVertex. The integer attributes
+// reach the shader unnormalized, it scales them itself.
+void drawPacked(GLuint program){
+    GLuint positionLocation = glGetAttribLocation(program, "vPosition");
+    GLuint normalLocation = glGetAttribLocation(program, "a_Normal");
+    GLuint halfWidthLocation = glGetAttribLocation(program, "a_HalfWidth");
+    glEnableVertexAttribArray(positionLocation);
+    glEnableVertexAttribArray(normalLocation);
+    glEnableVertexAttribArray(halfWidthLocation);
+
+    glBindBuffer(GL_ARRAY_BUFFER, vertexbuffers[currentBatch]);
+    glVertexAttribPointer(positionLocation, 2, GL_SHORT, GL_FALSE, sizeof(PackedStrokeVertex), (void*)offsetof(PackedStrokeVertex, x));
+    glVertexAttribPointer(normalLocation, 2, GL_BYTE, GL_FALSE, sizeof(PackedStrokeVertex), (void*)offsetof(PackedStrokeVertex, nx));
+    glVertexAttribPointer(halfWidthLocation, 1, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedStrokeVertex), (void*)offsetof(PackedStrokeVertex, halfWidth));
+
+    glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+
+    glDisableVertexAttribArray(positionLocation);
+    glDisableVertexAttribArray(normalLocation);
+    glDisableVertexAttribArray(halfWidthLocation);
+}
+
+// Makes program current with the transform and stroke uniforms for key.
+void useStrokeProgram(GLuint program, ShaderKey key){
+    glUseProgram(program);
+
+    // Packed positions are dequantized by the transform
+    if (key.packed) {
+        glm::mat3x2 tileToScreen = glm::affineScale(glm::affineTranslate(glm::mat3x2(1.0f), batchTile.origin), glm::vec2(batchTile.step));
+        SetTransform(program, glm::affineCompose(SCREEN_TO_CLIP, tileToScreen));
+    } else {
+        SetTransform(program, SCREEN_TO_CLIP);
     }
 
-    glClear(GL_COLOR_BUFFER_BIT);
+    GLint uniLineWidth = glGetUniformLocation(program, "u_lineWidth");
+    glUniform1f(uniLineWidth, lineWidth);
 
-    // Use our shader
-    glUseProgram(program);
+    GLint uniFeather = glGetUniformLocation(program, "u_feather");
+    glUniform1f(uniFeather, feather);
+}
 
-    // Ortho matrix
-    glm::mat4 modelView = glm::mat4(1.0f);
-    modelView = glm::translate(modelView, glm::vec3(0.0, 0.0, -1.0f));
-    GLint uniModelView = glGetUniformLocation(program, "modelView");
-    glUniformMatrix4fv(uniModelView, 1, GL_FALSE, glm::value_ptr(modelView));
+// Issues the draw of the instanced or pulled stroke.vert in program,
+// corners vertices per segment.
+void expandSegments(GLuint program, ExpandMode mode, GLsizei corners){
+    if (mode == EXPAND_PULLED) {
+        // No attributes at all, the shader finds its points from gl_VertexID
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_BUFFER, pointtextures[currentBatch]);
+        glUniform1i(glGetUniformLocation(program, "u_points"), 0);
+        glUniform1i(glGetUniformLocation(program, "u_pointCount"), segmentCount + 1);
+        glUniform1i(glGetUniformLocation(program, "u_corners"), corners);
+        glDrawArrays(GL_TRIANGLES, 0, corners * segmentCount);
+        return;
+    }
 
+    // Four views of the padded point buffer, advancing once per segment
+    const char *names[4] = { "a_Prev", "a_Start", "a_End", "a_Next" };
+    GLuint locations[4];
+    glBindBuffer(GL_ARRAY_BUFFER, pointbuffers[currentBatch]);
+    for (int i = 0; i < 4; i++) {
+        locations[i] = glGetAttribLocation(program, names[i]);
+        glEnableVertexAttribArray(locations[i]);
+        glVertexAttribPointer(locations[i], 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), (void*)(i * sizeof(glm::vec2)));
+        glVertexAttribDivisor(locations[i], 1);
+    }
 
-    glm::mat4 ortho = glm::ortho(0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0.0f, 0.1f, 100.0f);
-    GLint uniProj = glGetUniformLocation(program, "project");
-    glUniformMatrix4fv(uniProj, 1, GL_FALSE, glm::value_ptr(ortho));
+    glDrawArraysInstanced(GL_TRIANGLES, 0, corners, segmentCount);
 
-    GLint uniLineWidth = glGetUniformLocation(program, "u_lineWidth");
-    glUniform1f(uniLineWidth, lineWidth);
+    for (int i = 0; i < 4; i++) {
+        glVertexAttribDivisor(locations[i], 0);
+        glDisableVertexAttribArray(locations[i]);
+    }
+}
+
+// Expands the current stroke once more with the feedback variant of key,
+// into capturebuffer instead of the screen.
+void captureStroke(ExpandMode mode, ShaderKey key, GLsizei corners){
+    GLsizei count = corners * segmentCount;
+    GLsizeiptr size = count * sizeof(CapturedStrokeVertex);
+
+    glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, capturebuffer);
+    if (size > captureCapacity) {
+        glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER, size, NULL, GL_STATIC_DRAW);
+        captureCapacity = size;
+    }
+
+    key.feedback = CapturedStrokeVaryings();
+    GLuint program = GetShaderProgram("stroke.vert", "stroke.frag", key);
+    useStrokeProgram(program, key);
+
+    if (count > 0) {
+        glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, capturebuffer);
+        glEnable(GL_RASTERIZER_DISCARD);
+        glBeginTransformFeedback(GL_TRIANGLES);
+        expandSegments(program, mode, corners);
+        glEndTransformFeedback();
+        glDisable(GL_RASTERIZER_DISCARD);
+        glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    }
+
+    gCaptured.version = strokeVersion;
+    gCaptured.lineWidth = lineWidth;
+    gCaptured.keyBits = key.bits();
+    gCaptured.vertexCount = count;
+}
+
+// Draws the instanced or pulled stroke from capturebuffer, capturing it
+// first if anything it was expanded from changed.
+void drawCaptured(ExpandMode mode, ShaderKey key, GLsizei corners){
+    ShaderKey feedbackKey = key;
+    feedbackKey.feedback = CapturedStrokeVaryings();
+    if (gCaptured.version != strokeVersion || gCaptured.lineWidth != lineWidth || gCaptured.keyBits != feedbackKey.bits()) {
+        captureStroke(mode, key, corners);
+    }
+
+    // The same stroke.frag as the instanced stroke
+    ShaderKey drawKey(key.cap, key.join, key.aa, true);
+    GLuint program = GetShaderProgram("stroke_captured.vert", "stroke.frag", drawKey);
+    useStrokeProgram(program, drawKey);
+
+    const char *names[6] = { "a_Position", "a_Normal", "a_Along", "a_Length", "a_Round", "a_JoinSide" };
+    const GLint sizes[6] = { 2, 2, 1, 1, 2, 2 };
+    const size_t offsets[6] = {
+        offsetof(CapturedStrokeVertex, position),
+        offsetof(CapturedStrokeVertex, normal),
+        offsetof(CapturedStrokeVertex, along),
+        offsetof(CapturedStrokeVertex, length),
+        offsetof(CapturedStrokeVertex, round),
+        offsetof(CapturedStrokeVertex, joinSide)
+    };
+    GLuint locations[6];
+    glBindBuffer(GL_ARRAY_BUFFER, capturebuffer);
+    for (int i = 0; i < 6; i++) {
+        locations[i] = glGetAttribLocation(program, names[i]);
+        glEnableVertexAttribArray(locations[i]);
+        glVertexAttribPointer(locations[i], sizes[i], GL_FLOAT, GL_FALSE, sizeof(CapturedStrokeVertex), (void*)offsets[i]);
+    }
+
+    glDrawArrays(GL_TRIANGLES, 0, gCaptured.vertexCount);
+
+    for (int i = 0; i < 6; i++) {
+        glDisableVertexAttribArray(locations[i]);
+    }
+}
+
+// Draws the current batch expanded the way mode says.
+void drawStroke(ExpandMode mode){
+    // The CPU path is always miter joined with butt caps
+    ShaderKey key(CAP_BUTT, JOIN_MITER, AA_FEATHER, false, batchPacked);
+    if (mode != EXPAND_CPU) {
+        key = ShaderKey(gCap, gJoin, AA_FEATHER, true, false, mode == EXPAND_PULLED);
+    }
+
+    // Bevel joins add a triangle at the end of each segment
+    GLsizei corners = gJoin == JOIN_BEVEL ? 9 : 6;
+
+    if (gCapture && (mode == EXPAND_INSTANCED || mode == EXPAND_PULLED)) {
+        drawCaptured(mode, key, corners);
+        return;
+    }
+
+    GLuint program = mode == EXPAND_GEOMETRY ?
+        GetShaderProgram("stroke_adjacency.vert", "stroke.geom", "stroke.frag", key) :
+        GetShaderProgram("stroke.vert", "stroke.frag", key);
+    useStrokeProgram(program, key);
+
+    if (mode == EXPAND_GEOMETRY) {
+        // The padded points as one strip, every four consecutive points
+        // are a segment and its neighbours
+        GLuint location = glGetAttribLocation(program, "a_Point");
+        glBindBuffer(GL_ARRAY_BUFFER, pointbuffers[currentBatch]);
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(location, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), (void*)0);
+        glDrawArrays(GL_LINE_STRIP_ADJACENCY, 0, segmentCount > 0 ? segmentCount + 3 : 0);
+        glDisableVertexAttribArray(location);
+        return;
+    }
+
+    if (mode == EXPAND_PULLED || mode == EXPAND_INSTANCED) {
+        expandSegments(program, mode, corners);
+        return;
+    }
+
+    if (batchPacked) {
+        drawPacked(program);
+        return;
+    }
 
     // 1st attribute buffer : vertices
     GLuint VertexPosition_location = glGetAttribLocation(program, "vPosition");
     glEnableVertexAttribArray(VertexPosition_location);
-    glBindBuffer(GL_ARRAY_BUFFER, vertexbuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexbuffers[currentBatch]);
     glVertexAttribPointer(
                           VertexPosition_location,                  // attribute 0. No particular reason for 0, but must match the layout in the shader.
                           2,                  // size
                           GL_FLOAT,           // type
                           GL_FALSE,           // normalized?
-                          sizeof(GLfloat) * 4,                  // stride
+                          sizeof(StrokeVertex),                  // stride
                           (void*)0            // array buffer offset
                           );
 
     // 2nd attribute buffer : normals
     GLuint Normal_location = glGetAttribLocation(program, "a_Normal");
     glEnableVertexAttribArray(Normal_location);
-    glBindBuffer(GL_ARRAY_BUFFER, vertexbuffer);
     glVertexAttribPointer(
                           Normal_location,                  // attribute 0. No particular reason for 0, but must match the layout in the shader.
                           2,                  // size
                           GL_FLOAT,           // type
                           GL_FALSE,           // normalized?
-                          sizeof(GLfloat) * 4,                  // stride
+                          sizeof(StrokeVertex),                  // stride
                           (void*)(2 * sizeof(GLfloat))           // array buffer offset
                           );
 
 
     // Draw the triangle !
-    glDrawArrays(GL_TRIANGLES, 0, 12); // 3 indices starting at 0 -> 1 triangle
+    glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+
+    glDisableVertexAttribArray(VertexPosition_location);
+    glDisableVertexAttribArray(Normal_location);
+}
+
+// Mean GPU time of BENCHMARK_DRAWS draws of the current stroke, waiting
+// for each. With discard the rasterizer drops every triangle, which leaves
+// the vertex stage.
+double timeDraws(ExpandMode mode, bool discard){
+    // Compiles the program, and captures, outside the timing
+    drawStroke(mode);
+    glFinish();
+
+    if (discard) {
+        glEnable(GL_RASTERIZER_DISCARD);
+    }
+    GpuTimer timer;
+    for (int i = 0; i < BENCHMARK_DRAWS; i++) {
+        timer.begin();
+        drawStroke(mode);
+        timer.end();
+        glFinish();
+        timer.poll();
+    }
+    if (discard) {
+        glDisable(GL_RASTERIZER_DISCARD);
+    }
+    return timer.averageMilliseconds();
+}
+
+// Prints the GPU time of a draw of the current stroke in every mode, and
+// of its vertex stage alone. "captured" draws the instanced expansion from
+// the transform feedback cache, what it costs to capture is shown apart.
+// CPU expansion also tessellates whenever the stroke changes, timed here
+// on a tessellator of its own so the loader's is left alone.
+void benchmarkModes(){
+    printf("%zu points, %d segments\n", gPoints.size(), segmentCount);
+    printf("mode       draw ms  vertex stage ms\n");
+
+    bool capture = gCapture;
+    gCapture = false;
+    for (int mode = 0; mode < EXPAND_MODE_COUNT; mode++) {
+        double draw = timeDraws((ExpandMode)mode, false);
+        double vertex = timeDraws((ExpandMode)mode, true);
+        printf("%-10s %7.3f  %7.3f\n", EXPAND_MODE_NAMES[mode], draw, vertex);
+    }
 
-    glDisableVertexAttribArray(0);
+    gCapture = true;
+    double draw = timeDraws(EXPAND_INSTANCED, false);
+    double vertex = timeDraws(EXPAND_INSTANCED, true);
+    printf("%-10s %7.3f  %7.3f\n", "captured", draw, vertex);
+
+    // One capture on its own, as after any change to the stroke
+    ShaderKey key(gCap, gJoin, AA_FEATHER, true);
+    GpuTimer timer;
+    timer.begin();
+    captureStroke(EXPAND_INSTANCED, key, gJoin == JOIN_BEVEL ? 9 : 6);
+    timer.end();
+    glFinish();
+    timer.poll();
+    printf("capture    %7.3f ms once per change, %zu KB\n", timer.averageMilliseconds(), gCaptured.vertexCount * sizeof(CapturedStrokeVertex) / 1024);
+    gCapture = capture;
+
+    StrokeTessellator tessellator(gTessellator->threadCount());
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    size_t count = gSmooth ? tessellator.tessellateSmooth(gPoints, lineWidth) : tessellator.tessellate(gPoints, lineWidth);
+    std::vector<StrokeVertex> vertices(count);
+    if (count > 0) {
+        tessellator.stitch(&vertices[0]);
+    }
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    printf("cpu        %.3f ms to expand on %u threads\n", milliseconds, tessellator.threadCount());
+}
+
+void render(){
+    //Swap in uploads the loader has finished
+    gLoader->poll();
+
+    if (!gRender) {
+        // Clear the screen
+        glClear(GL_COLOR_BUFFER_BIT);
+        return ;
+    }
+
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    drawStroke(gMode);
 }
 
 void close(){
+    delete gTimer;
+    gTimer = NULL;
+    delete gLoader;
+    gLoader = NULL;
+    delete gTessellator;
+    gTessellator = NULL;
+
     //Destroy window
     SDL_DestroyWindow(gWindow);
     gWindow = NULL;
@@ -363,8 +861,16 @@ int main(int argc, char* args[]){
                 }
             }
 
-            //Render
+            //Render, timing the GPU side
+            gTimer->begin();
             render();
+            gTimer->end();
+            if (gTimer->sampleCount() >= TIMED_FRAMES) {
+                if (gLargeScene) {
+                    printf("%.3f ms per frame on the GPU\n", gTimer->averageMilliseconds());
+                }
+                gTimer->reset();
+            }
 
             //Update screen
             SDL_GL_SwapWindow(gWindow);
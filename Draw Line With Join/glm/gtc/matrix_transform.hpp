@@ -56,7 +56,7 @@ namespace glm
 	/// @see - translate(vec<3, T, Q> const& v)
 	/// @see <a href="https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glTranslate.xml">glTranslate man page</a> 
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL mat<4, 4, T, Q> translate(
+	GLM_FUNC_DECL GLM_CONSTEXPR_SIMD mat<4, 4, T, Q> translate(
 		mat<4, 4, T, Q> const& m,
 		vec<3, T, Q> const& v);
 		
@@ -86,7 +86,7 @@ namespace glm
 	/// @see - scale(vec<3, T, Q> const& v)
 	/// @see <a href="https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glScale.xml">glScale man page</a> 
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL mat<4, 4, T, Q> scale(
+	GLM_FUNC_DECL GLM_CONSTEXPR_SIMD mat<4, 4, T, Q> scale(
 		mat<4, 4, T, Q> const& m,
 		vec<3, T, Q> const& v);
 
@@ -97,7 +97,7 @@ namespace glm
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	/// @see <a href="https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glOrtho.xml">glOrtho man page</a> 
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> ortho(
+	GLM_FUNC_DECL GLM_CONSTEXPR_SIMD mat<4, 4, T, defaultp> ortho(
 		T left,
 		T right,
 		T bottom,
@@ -111,7 +111,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> orthoLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_SIMD mat<4, 4, T, defaultp> orthoLH(
 		T left,
 		T right,
 		T bottom,
@@ -125,7 +125,7 @@ namespace glm
 	/// @see gtc_matrix_transform
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> orthoRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_SIMD mat<4, 4, T, defaultp> orthoRH(
 		T left,
 		T right,
 		T bottom,
@@ -140,7 +140,7 @@ namespace glm
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top, T const& zNear, T const& zFar)
 	/// @see <a href="https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/gluOrtho2D.xml">gluOrtho2D man page</a> 
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> ortho(
+	GLM_FUNC_DECL GLM_CONSTEXPR_SIMD mat<4, 4, T, defaultp> ortho(
 		T left,
 		T right,
 		T bottom,
@@ -8,11 +8,9 @@
 namespace glm
 {
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> translate(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD mat<4, 4, T, Q> translate(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v)
 	{
-		mat<4, 4, T, Q> Result(m);
-		Result[3] = m[0] * v[0] + m[1] * v[1] + m[2] * v[2] + m[3];
-		return Result;
+		return mat<4, 4, T, Q>(m[0], m[1], m[2], m[0] * v.x + m[1] * v.y + m[2] * v.z + m[3]);
 	}
 	
 	template<typename T, qualifier Q>
@@ -76,14 +74,9 @@ namespace glm
 	}
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> scale(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD mat<4, 4, T, Q> scale(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v)
 	{
-		mat<4, 4, T, Q> Result;
-		Result[0] = m[0] * v[0];
-		Result[1] = m[1] * v[1];
-		Result[2] = m[2] * v[2];
-		Result[3] = m[3];
-		return Result;
+		return mat<4, 4, T, Q>(m[0] * v.x, m[1] * v.y, m[2] * v.z, m[3]);
 	}
 
 	template<typename T, qualifier Q>
@@ -97,7 +90,7 @@ namespace glm
 	}
 
 	template<typename T>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, defaultp> ortho
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD mat<4, 4, T, defaultp> ortho
 	(
 		T left, T right,
 		T bottom, T top,
@@ -112,69 +105,63 @@ namespace glm
 	}
 
 	template<typename T>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, defaultp> orthoLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD mat<4, 4, T, defaultp> orthoLH
 	(
 		T left, T right,
 		T bottom, T top,
 		T zNear, T zFar
 	)
 	{
-		mat<4, 4, T, defaultp> Result(1);
-		Result[0][0] = static_cast<T>(2) / (right - left);
-		Result[1][1] = static_cast<T>(2) / (top - bottom);
-		Result[3][0] = - (right + left) / (right - left);
-		Result[3][1] = - (top + bottom) / (top - bottom);
-
 #		if GLM_DEPTH_CLIP_SPACE == GLM_DEPTH_ZERO_TO_ONE
-			Result[2][2] = static_cast<T>(1) / (zFar - zNear);
-			Result[3][2] = - zNear / (zFar - zNear);
+			return mat<4, 4, T, defaultp>(
+				static_cast<T>(2) / (right - left), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0),
+				static_cast<T>(0), static_cast<T>(2) / (top - bottom), static_cast<T>(0), static_cast<T>(0),
+				static_cast<T>(0), static_cast<T>(0), static_cast<T>(1) / (zFar - zNear), static_cast<T>(0),
+				- (right + left) / (right - left), - (top + bottom) / (top - bottom), - zNear / (zFar - zNear), static_cast<T>(1));
 #		else
-			Result[2][2] = static_cast<T>(2) / (zFar - zNear);
-			Result[3][2] = - (zFar + zNear) / (zFar - zNear);
+			return mat<4, 4, T, defaultp>(
+				static_cast<T>(2) / (right - left), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0),
+				static_cast<T>(0), static_cast<T>(2) / (top - bottom), static_cast<T>(0), static_cast<T>(0),
+				static_cast<T>(0), static_cast<T>(0), static_cast<T>(2) / (zFar - zNear), static_cast<T>(0),
+				- (right + left) / (right - left), - (top + bottom) / (top - bottom), - (zFar + zNear) / (zFar - zNear), static_cast<T>(1));
 #		endif
-
-		return Result;
 	}
 
 	template<typename T>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, defaultp> orthoRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD mat<4, 4, T, defaultp> orthoRH
 	(
 		T left, T right,
 		T bottom, T top,
 		T zNear, T zFar
 	)
 	{
-		mat<4, 4, T, defaultp> Result(1);
-		Result[0][0] = static_cast<T>(2) / (right - left);
-		Result[1][1] = static_cast<T>(2) / (top - bottom);
-		Result[3][0] = - (right + left) / (right - left);
-		Result[3][1] = - (top + bottom) / (top - bottom);
-
 #		if GLM_DEPTH_CLIP_SPACE == GLM_DEPTH_ZERO_TO_ONE
-			Result[2][2] = - static_cast<T>(1) / (zFar - zNear);
-			Result[3][2] = - zNear / (zFar - zNear);
+			return mat<4, 4, T, defaultp>(
+				static_cast<T>(2) / (right - left), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0),
+				static_cast<T>(0), static_cast<T>(2) / (top - bottom), static_cast<T>(0), static_cast<T>(0),
+				static_cast<T>(0), static_cast<T>(0), - static_cast<T>(1) / (zFar - zNear), static_cast<T>(0),
+				- (right + left) / (right - left), - (top + bottom) / (top - bottom), - zNear / (zFar - zNear), static_cast<T>(1));
 #		else
-			Result[2][2] = - static_cast<T>(2) / (zFar - zNear);
-			Result[3][2] = - (zFar + zNear) / (zFar - zNear);
+			return mat<4, 4, T, defaultp>(
+				static_cast<T>(2) / (right - left), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0),
+				static_cast<T>(0), static_cast<T>(2) / (top - bottom), static_cast<T>(0), static_cast<T>(0),
+				static_cast<T>(0), static_cast<T>(0), - static_cast<T>(2) / (zFar - zNear), static_cast<T>(0),
+				- (right + left) / (right - left), - (top + bottom) / (top - bottom), - (zFar + zNear) / (zFar - zNear), static_cast<T>(1));
 #		endif
-
-		return Result;
 	}
 
 	template<typename T>
-	GLM_FUNC_QUALIFIER mat<4, 4, T, defaultp> ortho
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD mat<4, 4, T, defaultp> ortho
 	(
 		T left, T right,
 		T bottom, T top
 	)
 	{
-		mat<4, 4, T, defaultp> Result(static_cast<T>(1));
-		Result[0][0] = static_cast<T>(2) / (right - left);
-		Result[1][1] = static_cast<T>(2) / (top - bottom);
-		Result[2][2] = - static_cast<T>(1);
-		Result[3][0] = - (right + left) / (right - left);
-		Result[3][1] = - (top + bottom) / (top - bottom);
-		return Result;
+		return mat<4, 4, T, defaultp>(
+			static_cast<T>(2) / (right - left), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0),
+			static_cast<T>(0), static_cast<T>(2) / (top - bottom), static_cast<T>(0), static_cast<T>(0),
+			static_cast<T>(0), static_cast<T>(0), - static_cast<T>(1), static_cast<T>(0),
+			- (right + left) / (right - left), - (top + bottom) / (top - bottom), static_cast<T>(0), static_cast<T>(1));
 	}
 
 	template<typename T>
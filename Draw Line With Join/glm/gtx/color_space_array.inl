@@ -0,0 +1,146 @@
+/// @ref gtx_color_space_array
+/// @file glm/gtx/color_space_array.inl
+
+#include "../common.hpp"
+#include "../simd/packing.h"
+#include <cmath>
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// The tables glm_vec4_linearToSRGB8 reads, and the decoded codes
+	struct srgbTables
+	{
+		// Code at the start of each bucket of the linear range: the exponent
+		// of [2^-13, 1) and the top 8 mantissa bits. Near 1 a bucket is
+		// 0.4% wide and the codes 0.9% apart, in the linear part of the curve
+		// they are much further apart. 3 bytes of padding for AVX2 gathers.
+		u8 base[13 * 256 + 3];
+		// step[c] is the smallest float encoding to c, step[256] is past 1
+		float step[257];
+		float linear[256];
+
+		static double decode(double s)
+		{
+			return s <= 0.04045 ? s / 12.92 : std::pow((s + 0.055) / 1.055, 2.4);
+		}
+
+		srgbTables()
+		{
+			for(int c = 0; c < 256; ++c)
+				linear[c] = static_cast<float>(decode(c / 255.0));
+
+			// A code starts halfway from the one below it
+			step[0] = 0.0f;
+			for(int c = 1; c < 256; ++c)
+			{
+				double const t = decode((c - 0.5) / 255.0);
+				float f = static_cast<float>(t);
+				if(static_cast<double>(f) < t)
+				{
+					uint32 bits;
+					std::memcpy(&bits, &f, sizeof(f));
+					++bits;
+					std::memcpy(&f, &bits, sizeof(f));
+				}
+				step[c] = f;
+			}
+			step[256] = 2.0f;
+
+			int code = 0;
+			for(int b = 0; b < 13 * 256; ++b)
+			{
+				uint32 const bits = 0x39000000u + (static_cast<uint32>(b) << 15);
+				float start;
+				std::memcpy(&start, &bits, sizeof(start));
+				while(step[code + 1] <= start)
+					++code;
+				base[b] = static_cast<u8>(code);
+			}
+			base[13 * 256] = base[13 * 256 + 1] = base[13 * 256 + 2] = 0;
+		}
+	};
+
+	GLM_FUNC_QUALIFIER srgbTables const& srgbTable()
+	{
+		static srgbTables const Table;
+		return Table;
+	}
+
+#	if !(GLM_ARCH & GLM_ARCH_SSE2_BIT)
+		// glm_vec4_linearToSRGB8 on one value
+		GLM_FUNC_QUALIFIER u8 linearToSRGB8(float x, srgbTables const& Table)
+		{
+			uint32 const MinBits = 0x39000000u;
+			uint32 const MaxBits = 0x3f7fffffu;
+			float Min, Max;
+			std::memcpy(&Min, &MinBits, sizeof(Min));
+			std::memcpy(&Max, &MaxBits, sizeof(Max));
+
+			float c = x > Min ? x : Min;
+			c = c < Max ? c : Max;
+			uint32 bits;
+			std::memcpy(&bits, &c, sizeof(c));
+			int const code = Table.base[(bits - MinBits) >> 15];
+			return static_cast<u8>(c >= Table.step[code + 1] ? code + 1 : code);
+		}
+
+		// packUnorm4x8 on one value
+		GLM_FUNC_QUALIFIER u8 alphaToUnorm8(float a)
+		{
+			float c = a > 0.0f ? a : 0.0f;
+			c = c < 1.0f ? c : 1.0f;
+			return static_cast<u8>(round(c * 255.0f));
+		}
+#	endif
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void convertLinearToSRGB(float const* linear, u8* srgb, std::size_t count)
+	{
+		detail::srgbTables const& Table = detail::srgbTable();
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_linear_to_srgb8(linear, srgb, count, false, Table.base, Table.step);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				srgb[i] = detail::linearToSRGB8(linear[i], Table);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void convertLinearToSRGB(vec4 const* linear, u8vec4* srgb, std::size_t count)
+	{
+		detail::srgbTables const& Table = detail::srgbTable();
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_linear_to_srgb8(&linear[0].x, &srgb[0].x, count * 4, true, Table.base, Table.step);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				srgb[i] = u8vec4(
+					detail::linearToSRGB8(linear[i].x, Table),
+					detail::linearToSRGB8(linear[i].y, Table),
+					detail::linearToSRGB8(linear[i].z, Table),
+					detail::alphaToUnorm8(linear[i].w));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void convertSRGBToLinear(u8 const* srgb, float* linear, std::size_t count)
+	{
+		detail::srgbTables const& Table = detail::srgbTable();
+
+		for(std::size_t i = 0; i < count; ++i)
+			linear[i] = Table.linear[srgb[i]];
+	}
+
+	GLM_FUNC_QUALIFIER void convertSRGBToLinear(u8vec4 const* srgb, vec4* linear, std::size_t count)
+	{
+		detail::srgbTables const& Table = detail::srgbTable();
+
+		for(std::size_t i = 0; i < count; ++i)
+			linear[i] = vec4(
+				Table.linear[srgb[i].x],
+				Table.linear[srgb[i].y],
+				Table.linear[srgb[i].z],
+				static_cast<float>(srgb[i].w) * 0.0039215686274509803921568627451f);
+	}
+}//namespace glm
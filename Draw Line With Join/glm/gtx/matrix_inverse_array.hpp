@@ -0,0 +1,60 @@
+/// @ref gtx_matrix_inverse_array
+/// @file glm/gtx/matrix_inverse_array.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_matrix_inverse_array GLM_GTX_matrix_inverse_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_inverse_array.hpp> to use the features of this extension.
+///
+/// Inverts whole arrays of matrices. With SSE2 the matrices are transposed
+/// four at a time, eight with AVX, into one lane each, and inverted side by
+/// side by the glm/simd/matrix.h kernels. The results are the same bits as
+/// glm::inverse on each matrix when multiplies and adds stay separate. FMA
+/// contraction changes them: GCC contracts by default once FMA is enabled
+/// (-mfma, -mavx2 -mfma, -march=native), and then most matrices differ
+/// from glm::inverse by about 1 ulp. -ffp-contract=off gives the same bits
+/// again.
+
+#pragma once
+
+// Dependency:
+#include "../mat4x4.hpp"
+#include "../matrix.hpp"
+#include "../common.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_matrix_inverse_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_matrix_inverse_array extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_inverse_array
+	/// @{
+
+	/// out[i] = inverse(in[i]) for count matrices. in and out may be the same array.
+	///
+	/// @see gtx_matrix_inverse_array
+	GLM_FUNC_DECL void inverse(mat4 const* in, mat4* out, std::size_t count);
+
+	/// out[i] = inverse(in[i]) for the matrices whose |determinant| is above
+	/// minDeterminant, a zero matrix for the others. invertible, when not
+	/// NULL, receives count flags telling which were inverted. A NaN
+	/// determinant is never above minDeterminant, so with a negative one
+	/// only those matrices are zeroed. Every build follows this rule. in and
+	/// out may be the same array.
+	///
+	/// @return How many matrices were not inverted.
+	/// @see gtx_matrix_inverse_array
+	GLM_FUNC_DECL std::size_t inverseGuarded(mat4 const* in, mat4* out, std::size_t count, float minDeterminant, bool* invertible = NULL);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_inverse_array.inl"
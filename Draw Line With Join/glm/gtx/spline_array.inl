@@ -0,0 +1,197 @@
+/// @ref gtx_spline_array
+/// @file glm/gtx/spline_array.inl
+
+#include "../geometric.hpp"
+#include "../simd/geometric.h"
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	// The span as a * s^3 + b * s^2 + c * s + d. a, b and c are built from
+	// differences of the points, which are exact for points close together,
+	// so they do not round at the scale of the coordinates.
+	struct splineSpan
+	{
+		vec2 a, b, c, d;
+	};
+
+	GLM_FUNC_QUALIFIER splineSpan catmullRomSpan(vec2 const& v1, vec2 const& v2, vec2 const& v3, vec2 const& v4)
+	{
+		vec2 const d1 = v1 - v2;
+		vec2 const d3 = v3 - v2;
+		vec2 const d4 = v4 - v2;
+
+		splineSpan Span;
+		Span.a = (-d1 - 3.0f * d3 + d4) * 0.5f;
+		Span.b = (2.0f * d1 + 4.0f * d3 - d4) * 0.5f;
+		Span.c = (v3 - v1) * 0.5f;
+		Span.d = v2;
+		return Span;
+	}
+
+	GLM_FUNC_QUALIFIER splineSpan hermiteSpan(vec2 const& v1, vec2 const& t1, vec2 const& v2, vec2 const& t2)
+	{
+		vec2 const d2 = v2 - v1;
+
+		splineSpan Span;
+		Span.a = -2.0f * d2 + t1 + t2;
+		Span.b = 3.0f * d2 - 2.0f * t1 - t2;
+		Span.c = t1;
+		Span.d = v1;
+		return Span;
+	}
+
+	GLM_FUNC_QUALIFIER splineSpan cubicSpan(vec2 const& v1, vec2 const& v2, vec2 const& v3, vec2 const& v4)
+	{
+		splineSpan Span;
+		Span.a = v1;
+		Span.b = v2;
+		Span.c = v3;
+		Span.d = v4;
+		return Span;
+	}
+
+	// Four chains interleave, chain k giving the points k, k + 4, k + 8,
+	// ..., so the additions of one chain overlap those of the others and
+	// fill a SIMD register. They start from values computed in double and
+	// run on P(s) - P(0), so their rounding follows the size of the span
+	// rather than that of its coordinates. P(0) is added back on store.
+	GLM_FUNC_QUALIFIER void forwardDifference(splineSpan const& Span, std::size_t segments, float* x, float* y)
+	{
+		float const Origin[2] = {Span.d.x, Span.d.y};
+		double const h = 1.0 / static_cast<double>(segments);
+		double const H = 4.0 * h;
+		double const H2 = H * H;
+		double const H3 = H2 * H;
+
+		// Rows of glm_vec4_forward_difference: P(s) - P(0) and its first,
+		// second and third differences for a step of H, x then y
+		float Lanes[8][4];
+		for(length_t j = 0; j < 2; ++j)
+		{
+			double const a = Span.a[j];
+			double const b = Span.b[j];
+			double const c = Span.c[j];
+			for(int k = 0; k < 4; ++k)
+			{
+				double const t = k * h;
+				Lanes[0 + j][k] = static_cast<float>(((a * t + b) * t + c) * t);
+				Lanes[2 + j][k] = static_cast<float>(a * (3.0 * t * t * H + 3.0 * t * H2 + H3) + b * (2.0 * t * H + H2) + c * H);
+				Lanes[4 + j][k] = static_cast<float>(6.0 * a * H2 * t + 6.0 * a * H3 + 2.0 * b * H2);
+				Lanes[6 + j][k] = static_cast<float>(6.0 * a * H3);
+			}
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_vec4_forward_difference(Lanes, Origin, segments, x, y);
+#		else
+			std::size_t i = 0;
+			for(; i + 4 <= segments; i += 4)
+				for(int k = 0; k < 4; ++k)
+				{
+					x[i + k] = Lanes[0][k] + Origin[0];
+					y[i + k] = Lanes[1][k] + Origin[1];
+					for(int j = 0; j < 2; ++j)
+					{
+						Lanes[0 + j][k] += Lanes[2 + j][k];
+						Lanes[2 + j][k] += Lanes[4 + j][k];
+						Lanes[4 + j][k] += Lanes[6 + j][k];
+					}
+				}
+			for(std::size_t k = 0; i + k < segments; ++k)
+			{
+				x[i + k] = Lanes[0][k] + Origin[0];
+				y[i + k] = Lanes[1][k] + Origin[1];
+			}
+#		endif
+	}
+
+	// Whether the span stays within tolerance of the segment from its start
+	// to its end. Across the chord, P . N is 0 at both ends and so within
+	// max |(P . N)''| / 8 between them. Along it, P . T may only leave the
+	// segment at a turning point, a root of its derivative. A straight line
+	// passes whatever its speed along the chord.
+	GLM_FUNC_QUALIFIER bool splineFollowsChord(splineSpan const& Span, float tolerance)
+	{
+		vec2 const Chord = Span.a + Span.b + Span.c;
+		float const Length = length(Chord);
+		if(Length <= 0.0f)
+			return false;
+
+		vec2 const T = Chord / Length;
+		vec2 const N(-T.y, T.x);
+		float const AcrossA = dot(Span.a, N);
+		float const AcrossB = dot(Span.b, N);
+		if(max(abs(2.0f * AcrossB), abs(6.0f * AcrossA + 2.0f * AcrossB)) > 8.0f * tolerance)
+			return false;
+
+		// Roots of 3 * a * s^2 + 2 * b * s + c, without cancellation
+		float const a = dot(Span.a, T);
+		float const b = dot(Span.b, T);
+		float const c = dot(Span.c, T);
+		float const Discriminant = b * b - 3.0f * a * c;
+		if(Discriminant < 0.0f)
+			return true;
+		float const q = -(b + (b < 0.0f ? -1.0f : 1.0f) * std::sqrt(Discriminant));
+		float Roots[2] = {-1.0f, -1.0f};
+		if(a != 0.0f)
+			Roots[0] = q / (3.0f * a);
+		if(q != 0.0f)
+			Roots[1] = c / q;
+		for(int i = 0; i < 2; ++i)
+		{
+			float const s = Roots[i];
+			if(s <= 0.0f || s >= 1.0f)
+				continue;
+			float const Along = ((a * s + b) * s + c) * s;
+			if(Along < -tolerance || Along > Length + tolerance)
+				return false;
+		}
+		return true;
+	}
+
+	// The second derivative 6 * a * s + 2 * b is linear, so its largest
+	// length is at s = 0 or s = 1. n chords stay within max / (8 * n^2).
+	GLM_FUNC_QUALIFIER std::size_t splineSegments(splineSpan const& Span, float tolerance)
+	{
+		if(splineFollowsChord(Span, tolerance))
+			return 1;
+
+		float const Start = length(2.0f * Span.b);
+		float const End = length(6.0f * Span.a + 2.0f * Span.b);
+		float const Segments = std::ceil(std::sqrt(max(Start, End) / (8.0f * tolerance)));
+		return Segments < 1.0f ? 1 : Segments < 1024.0f ? static_cast<std::size_t>(Segments) : 1024;
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void catmullRom(vec2 const& v1, vec2 const& v2, vec2 const& v3, vec2 const& v4, std::size_t segments, float* x, float* y)
+	{
+		detail::forwardDifference(detail::catmullRomSpan(v1, v2, v3, v4), segments, x, y);
+	}
+
+	GLM_FUNC_QUALIFIER void hermite(vec2 const& v1, vec2 const& t1, vec2 const& v2, vec2 const& t2, std::size_t segments, float* x, float* y)
+	{
+		detail::forwardDifference(detail::hermiteSpan(v1, t1, v2, t2), segments, x, y);
+	}
+
+	GLM_FUNC_QUALIFIER void cubic(vec2 const& v1, vec2 const& v2, vec2 const& v3, vec2 const& v4, std::size_t segments, float* x, float* y)
+	{
+		detail::forwardDifference(detail::cubicSpan(v1, v2, v3, v4), segments, x, y);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t catmullRomSegments(vec2 const& v1, vec2 const& v2, vec2 const& v3, vec2 const& v4, float tolerance)
+	{
+		return detail::splineSegments(detail::catmullRomSpan(v1, v2, v3, v4), tolerance);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t hermiteSegments(vec2 const& v1, vec2 const& t1, vec2 const& v2, vec2 const& t2, float tolerance)
+	{
+		return detail::splineSegments(detail::hermiteSpan(v1, t1, v2, t2), tolerance);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t cubicSegments(vec2 const& v1, vec2 const& v2, vec2 const& v3, vec2 const& v4, float tolerance)
+	{
+		return detail::splineSegments(detail::cubicSpan(v1, v2, v3, v4), tolerance);
+	}
+}//namespace glm
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "common.h"
+#include <cstddef>
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -121,4 +122,45 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 	return sub2;
 }
 
+// count points of a 2D cubic by forward differencing, four at a time.
+// Lane k follows every fourth point from point k: rows 0 and 1 of lanes
+// hold x and y at the first of them, rows 2 to 7 the x and y of the first,
+// second and third differences for a step of four points. The points are
+// relative to origin, which is added as they are stored.
+GLM_FUNC_QUALIFIER void glm_vec4_forward_difference(float const lanes[8][4], float const origin[2], std::size_t count, float* x, float* y)
+{
+	glm_vec4 const ox = _mm_set1_ps(origin[0]);
+	glm_vec4 const oy = _mm_set1_ps(origin[1]);
+	glm_vec4 px = _mm_loadu_ps(lanes[0]);
+	glm_vec4 py = _mm_loadu_ps(lanes[1]);
+	glm_vec4 d1x = _mm_loadu_ps(lanes[2]);
+	glm_vec4 d1y = _mm_loadu_ps(lanes[3]);
+	glm_vec4 d2x = _mm_loadu_ps(lanes[4]);
+	glm_vec4 d2y = _mm_loadu_ps(lanes[5]);
+	glm_vec4 const d3x = _mm_loadu_ps(lanes[6]);
+	glm_vec4 const d3y = _mm_loadu_ps(lanes[7]);
+
+	std::size_t i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		_mm_storeu_ps(x + i, _mm_add_ps(px, ox));
+		_mm_storeu_ps(y + i, _mm_add_ps(py, oy));
+		px = _mm_add_ps(px, d1x);
+		py = _mm_add_ps(py, d1y);
+		d1x = _mm_add_ps(d1x, d2x);
+		d1y = _mm_add_ps(d1y, d2y);
+		d2x = _mm_add_ps(d2x, d3x);
+		d2y = _mm_add_ps(d2y, d3y);
+	}
+
+	float tailX[4], tailY[4];
+	_mm_storeu_ps(tailX, _mm_add_ps(px, ox));
+	_mm_storeu_ps(tailY, _mm_add_ps(py, oy));
+	for(std::size_t k = 0; i + k < count; ++k)
+	{
+		x[i + k] = tailX[k];
+		y[i + k] = tailY[k];
+	}
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
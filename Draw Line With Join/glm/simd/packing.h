@@ -3,6 +3,277 @@
 
 #pragma once
 
+#include "common.h"
+#include "cpu.h"
+#include <cstddef>
+#include <cstring>
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// F16C has no GLM_ARCH bit. GCC and Clang define __F16C__ for it, Visual C++
+// only knows /arch:AVX2, which comes with it.
+#if defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT))
+#	define GLM_SIMD_F16C 1
+#else
+#	define GLM_SIMD_F16C 0
+#endif
+
+// The kernels give the same bits as the scalar functions of func_packing.inl,
+// including glm::round rounding halves away from zero and toFloat16 rounding
+// the 13 dropped bits "0.5 up". The one exception is glm_vec4_unpackHalf on
+// F16C, which quiets signaling NaNs. Define GLM_FORCE_HALF_ROUND_EVEN to
+// pack halves with F16C as well, rounding ties to even like the GPU does.
+
+// mask ? a : b
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_select(glm_ivec4 mask, glm_ivec4 a, glm_ivec4 b)
+{
+	glm_ivec4 const and0 = _mm_and_si128(mask, a);
+	glm_ivec4 const and1 = _mm_andnot_si128(mask, b);
+	return _mm_or_si128(and0, and1);
+}
+
+// Rounds halves away from zero like glm::round, |x| < 2^31
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_iround(glm_vec4 x)
+{
+	glm_ivec4 const trn0 = _mm_cvttps_epi32(x);
+	glm_vec4 const frc0 = glm_vec4_sub(x, _mm_cvtepi32_ps(trn0));
+	glm_ivec4 const up0 = _mm_castps_si128(_mm_cmpge_ps(frc0, _mm_set1_ps(0.5f)));
+	glm_ivec4 const dn0 = _mm_castps_si128(_mm_cmple_ps(frc0, _mm_set1_ps(-0.5f)));
+	return _mm_add_epi32(_mm_sub_epi32(trn0, up0), dn0);
+}
+
+// Four halves in the low 64 bits
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_packHalf(glm_vec4 v)
+{
+#	if GLM_SIMD_F16C && defined(GLM_FORCE_HALF_ROUND_EVEN)
+		return _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+#	else
+		glm_ivec4 const bits = _mm_castps_si128(v);
+		glm_ivec4 const abs0 = _mm_and_si128(bits, _mm_set1_epi32(0x7fffffff));
+		glm_ivec4 const sgn0 = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+		glm_ivec4 const inf0 = _mm_set1_epi32(0x7c00);
+
+		// Normal: rebias the exponent and round the 13 dropped bits. A carry out
+		// of the mantissa moves into the exponent, past 65504 that is infinity.
+		glm_ivec4 const nrm0 = _mm_srli_epi32(_mm_add_epi32(abs0, _mm_set1_epi32(0x1000 - 0x38000000)), 13);
+		glm_ivec4 const nrm1 = glm_ivec4_select(_mm_cmpgt_epi32(nrm0, inf0), inf0, nrm0);
+
+		// Below 2^-14 the half is denormal, in steps of 2^-24
+		glm_ivec4 const den0 = glm_vec4_iround(glm_vec4_mul(_mm_castsi128_ps(abs0), _mm_set1_ps(16777216.0f)));
+		glm_ivec4 const isDen = _mm_cmplt_epi32(abs0, _mm_set1_epi32(0x38800000));
+
+		// NaN keeps the top of its payload, with at least one bit set
+		glm_ivec4 const pay0 = _mm_srli_epi32(_mm_and_si128(abs0, _mm_set1_epi32(0x007fffff)), 13);
+		glm_ivec4 const pay1 = _mm_or_si128(pay0, _mm_and_si128(_mm_cmpeq_epi32(pay0, _mm_setzero_si128()), _mm_set1_epi32(1)));
+		glm_ivec4 const isNan = _mm_cmpgt_epi32(abs0, _mm_set1_epi32(0x7f800000));
+
+		glm_ivec4 const sel0 = glm_ivec4_select(isNan, _mm_or_si128(inf0, pay1), nrm1);
+		glm_ivec4 const sel1 = glm_ivec4_select(isDen, den0, sel0);
+		glm_ivec4 const half = _mm_or_si128(sel1, sgn0);
+
+		// Sign extend so the saturating pack keeps all 16 bits
+		glm_ivec4 const ext0 = _mm_srai_epi32(_mm_slli_epi32(half, 16), 16);
+		return _mm_packs_epi32(ext0, ext0);
+#	endif
+}
+
+// Four halves from the low 64 bits
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpackHalf(glm_ivec4 p)
+{
+#	if GLM_SIMD_F16C
+		return _mm_cvtph_ps(p);
+#	else
+		glm_ivec4 const half = _mm_unpacklo_epi16(p, _mm_setzero_si128());
+		glm_ivec4 const sgn0 = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x8000)), 16);
+		glm_ivec4 const abs0 = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x7fff)), 13);
+		glm_ivec4 const exp0 = _mm_and_si128(abs0, _mm_set1_epi32(0x0f800000));
+
+		// Rebias the exponent, twice for infinity and NaN
+		glm_ivec4 const nrm0 = _mm_add_epi32(abs0, _mm_set1_epi32(0x38000000));
+		glm_ivec4 const isSpecial = _mm_cmpeq_epi32(exp0, _mm_set1_epi32(0x0f800000));
+		glm_ivec4 const nrm1 = _mm_add_epi32(nrm0, _mm_and_si128(isSpecial, _mm_set1_epi32(0x38000000)));
+
+		// Zero and denormals: give them the exponent of 2^-14, then take 2^-14 off
+		glm_vec4 const den0 = _mm_castsi128_ps(_mm_add_epi32(nrm0, _mm_set1_epi32(0x00800000)));
+		glm_ivec4 const den1 = _mm_castps_si128(glm_vec4_sub(den0, _mm_set1_ps(6.103515625e-5f)));
+		glm_ivec4 const isDen = _mm_cmpeq_epi32(exp0, _mm_setzero_si128());
+
+		return _mm_castsi128_ps(_mm_or_si128(glm_ivec4_select(isDen, den1, nrm1), sgn0));
+#	endif
+}
+
+// Clamps like the scalar clamp: max first, which gives its second operand
+// for NaN, so NaN becomes minVal. glm_vec4_clamp makes it maxVal.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_packClamp(glm_vec4 v, glm_vec4 minVal, glm_vec4 maxVal)
+{
+	return _mm_min_ps(_mm_max_ps(v, minVal), maxVal);
+}
+
+// Eight snorm16 values, a in the low 64 bits. NaN packs as -1.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_packSnorm16(glm_vec4 a, glm_vec4 b)
+{
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const scl = _mm_set1_ps(32767.0f);
+	glm_ivec4 const rnd0 = glm_vec4_iround(glm_vec4_mul(glm_vec4_packClamp(a, _mm_set1_ps(-1.0f), one), scl));
+	glm_ivec4 const rnd1 = glm_vec4_iround(glm_vec4_mul(glm_vec4_packClamp(b, _mm_set1_ps(-1.0f), one), scl));
+	return _mm_packs_epi32(rnd0, rnd1);
+}
+
+// Four snorm16 values from the low 64 bits
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpackSnorm16(glm_ivec4 p)
+{
+	glm_ivec4 const ext0 = _mm_srai_epi32(_mm_unpacklo_epi16(p, p), 16);
+	glm_vec4 const mul0 = glm_vec4_mul(_mm_cvtepi32_ps(ext0), _mm_set1_ps(3.0518509475997192297128208258309e-5f));
+	return glm_vec4_clamp(mul0, _mm_set1_ps(-1.0f), _mm_set1_ps(1.0f));
+}
+
+// Sixteen unorm8 values, a in the low 32 bits. NaN packs as 0.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_packUnorm8(glm_vec4 a, glm_vec4 b, glm_vec4 c, glm_vec4 d)
+{
+	glm_vec4 const zro = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const scl = _mm_set1_ps(255.0f);
+	glm_ivec4 const rnd0 = glm_vec4_iround(glm_vec4_mul(glm_vec4_packClamp(a, zro, one), scl));
+	glm_ivec4 const rnd1 = glm_vec4_iround(glm_vec4_mul(glm_vec4_packClamp(b, zro, one), scl));
+	glm_ivec4 const rnd2 = glm_vec4_iround(glm_vec4_mul(glm_vec4_packClamp(c, zro, one), scl));
+	glm_ivec4 const rnd3 = glm_vec4_iround(glm_vec4_mul(glm_vec4_packClamp(d, zro, one), scl));
+	return _mm_packus_epi16(_mm_packs_epi32(rnd0, rnd1), _mm_packs_epi32(rnd2, rnd3));
+}
+
+// Four unorm8 values from the low 32 bits
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpackUnorm8(glm_ivec4 p)
+{
+	glm_ivec4 const zro = _mm_setzero_si128();
+	glm_ivec4 const ext0 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(p, zro), zro);
+	return glm_vec4_mul(_mm_cvtepi32_ps(ext0), _mm_set1_ps(0.0039215686274509803921568627451f));
+}
+
+// sRGB codes 0 to 255 of four linear values, rounded to nearest, from the
+// tables of gtx_color_space_array. x is first clamped to [2^-13, 1), NaN
+// to 2^-13, which changes no code. The exponent and top 8 mantissa bits
+// then pick one of 13 * 256 buckets and base holds the code at the start
+// of each. No bucket spans two steps, so the code is base, or base + 1
+// once x reaches step[base + 1], the smallest float with that code.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_linearToSRGB8(glm_vec4 x, unsigned char const* base, float const* step)
+{
+	glm_vec4 const max0 = _mm_max_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x39000000)));
+	glm_vec4 const min0 = _mm_min_ps(max0, _mm_castsi128_ps(_mm_set1_epi32(0x3f7fffff)));
+	glm_ivec4 const idx0 = _mm_srli_epi32(_mm_sub_epi32(_mm_castps_si128(min0), _mm_set1_epi32(0x39000000)), 15);
+
+	int idx[4];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(idx), idx0);
+	int const c0 = base[idx[0]];
+	int const c1 = base[idx[1]];
+	int const c2 = base[idx[2]];
+	int const c3 = base[idx[3]];
+
+	glm_vec4 const next = _mm_setr_ps(step[c0 + 1], step[c1 + 1], step[c2 + 1], step[c3 + 1]);
+	return _mm_sub_epi32(_mm_setr_epi32(c0, c1, c2, c3), _mm_castps_si128(_mm_cmpge_ps(min0, next)));
+}
+
+// glm_vec4_linearToSRGB8, but the lanes set in isAlpha are alpha and
+// packed as unorm8
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_linearToSRGBA8(glm_vec4 x, glm_ivec4 isAlpha, unsigned char const* base, float const* step)
+{
+	glm_vec4 const clp0 = glm_vec4_packClamp(x, _mm_setzero_ps(), _mm_set1_ps(1.0f));
+	glm_ivec4 const alpha = glm_vec4_iround(glm_vec4_mul(clp0, _mm_set1_ps(255.0f)));
+	return glm_ivec4_select(isAlpha, alpha, glm_vec4_linearToSRGB8(x, base, step));
+}
+
+// sRGB codes of count linear values. With alpha set every fourth value,
+// from the fourth on, is alpha and packed as unorm8 instead.
+// glm_linear_to_srgb8 picks the widest version the CPU runs.
+GLM_FUNC_QUALIFIER void glm_linear_to_srgb8_sse(float const* in, unsigned char* out, std::size_t count, bool alpha, unsigned char const* base, float const* step)
+{
+	glm_ivec4 const isAlpha = alpha ? _mm_setr_epi32(0, 0, 0, -1) : _mm_setzero_si128();
+
+	std::size_t i = 0;
+	for(; i + 16 <= count; i += 16)
+	{
+		glm_ivec4 code[4];
+		for(int j = 0; j < 4; ++j)
+		{
+			glm_vec4 const x = _mm_loadu_ps(in + i + j * 4);
+			code[j] = alpha ? glm_vec4_linearToSRGBA8(x, isAlpha, base, step) : glm_vec4_linearToSRGB8(x, base, step);
+		}
+		glm_ivec4 const pck0 = _mm_packus_epi16(_mm_packs_epi32(code[0], code[1]), _mm_packs_epi32(code[2], code[3]));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), pck0);
+	}
+	if(i < count)
+	{
+		float pad[16] = {0};
+		unsigned char pck[16];
+		std::memcpy(pad, in + i, (count - i) * sizeof(float));
+		glm_linear_to_srgb8_sse(pad, pck, 16, alpha, base, step);
+		std::memcpy(out + i, pck, count - i);
+	}
+}
+
+#if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+
+// glm_vec4_linearToSRGB8 on eight values, with both lookups gathered.
+// base needs 3 readable bytes past its end for the 32 bit gather.
+GLM_SIMD_TARGET("avx2") inline __m256i glm_vec8_linearToSRGB8_avx2(__m256 x, unsigned char const* base, float const* step)
+{
+	__m256 const max0 = _mm256_max_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x39000000)));
+	__m256 const min0 = _mm256_min_ps(max0, _mm256_castsi256_ps(_mm256_set1_epi32(0x3f7fffff)));
+	__m256i const idx0 = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(min0), _mm256_set1_epi32(0x39000000)), 15);
+
+	__m256i const code = _mm256_and_si256(_mm256_i32gather_epi32(reinterpret_cast<int const*>(base), idx0, 1), _mm256_set1_epi32(0xff));
+	__m256 const next = _mm256_i32gather_ps(step + 1, code, 4);
+	return _mm256_sub_epi32(code, _mm256_castps_si256(_mm256_cmp_ps(min0, next, _CMP_GE_OQ)));
+}
+
+GLM_SIMD_TARGET("avx2") inline __m256i glm_vec8_linearToSRGBA8_avx2(__m256 x, __m256i isAlpha, unsigned char const* base, float const* step)
+{
+	__m256 const clp0 = _mm256_min_ps(_mm256_max_ps(x, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+	__m256 const mul0 = _mm256_mul_ps(clp0, _mm256_set1_ps(255.0f));
+
+	// glm_vec4_iround, for values that are never negative
+	__m256i const trn0 = _mm256_cvttps_epi32(mul0);
+	__m256 const frc0 = _mm256_sub_ps(mul0, _mm256_cvtepi32_ps(trn0));
+	__m256i const alpha = _mm256_sub_epi32(trn0, _mm256_castps_si256(_mm256_cmp_ps(frc0, _mm256_set1_ps(0.5f), _CMP_GE_OQ)));
+
+	__m256i const srgb = glm_vec8_linearToSRGB8_avx2(x, base, step);
+	return _mm256_or_si256(_mm256_and_si256(isAlpha, alpha), _mm256_andnot_si256(isAlpha, srgb));
+}
+
+GLM_SIMD_TARGET("avx2") inline void glm_linear_to_srgb8_avx2(float const* in, unsigned char* out, std::size_t count, bool alpha, unsigned char const* base, float const* step)
+{
+	__m256i const isAlpha = alpha ? _mm256_setr_epi32(0, 0, 0, -1, 0, 0, 0, -1) : _mm256_setzero_si256();
+
+	std::size_t i = 0;
+	for(; i + 16 <= count; i += 16)
+	{
+		__m256 const x0 = _mm256_loadu_ps(in + i);
+		__m256 const x1 = _mm256_loadu_ps(in + i + 8);
+		__m256i const code0 = alpha ? glm_vec8_linearToSRGBA8_avx2(x0, isAlpha, base, step) : glm_vec8_linearToSRGB8_avx2(x0, base, step);
+		__m256i const code1 = alpha ? glm_vec8_linearToSRGBA8_avx2(x1, isAlpha, base, step) : glm_vec8_linearToSRGB8_avx2(x1, base, step);
+
+		// The 256 bit pack works within 128 bit halves, put them back in order
+		__m256i const pck0 = _mm256_permute4x64_epi64(_mm256_packs_epi32(code0, code1), 0xd8);
+		__m128i const pck1 = _mm_packus_epi16(_mm256_castsi256_si128(pck0), _mm256_extracti128_si256(pck0, 1));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), pck1);
+	}
+	glm_linear_to_srgb8_sse(in + i, out + i, count - i, alpha, base, step);
+}
+
+#endif//GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+
+GLM_FUNC_QUALIFIER void glm_linear_to_srgb8(float const* in, unsigned char* out, std::size_t count, bool alpha, unsigned char const* base, float const* step)
+{
+#	if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+#		if GLM_SIMD_DISPATCH
+			int const Arch = GLM_ARCH | glm_cpu_arch();
+#		else
+			int const Arch = GLM_ARCH;
+#		endif
+
+		if(Arch & GLM_ARCH_AVX2_BIT)
+			glm_linear_to_srgb8_avx2(in, out, count, alpha, base, step);
+		else
+#	endif
+			glm_linear_to_srgb8_sse(in, out, count, alpha, base, step);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -3,7 +3,142 @@
 
 #pragma once
 
+#include "common.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+// Polynomial kernels after Cephes' single precision sinf, cosf, atanf and
+// asinf. Maximum error against a double precision reference, measured over
+// 2^22 points per range with SSE2, SSE4.1 and AVX2/FMA builds:
+//
+//   glm_vec4_sin, glm_vec4_cos, glm_vec4_sincos	|x| <= 8192			1.6 ulp, 1e-7 absolute next to zeros
+//   glm_vec4_atan2									finite y, x			3.1 ulp
+//   glm_vec4_acos									-1 <= x <= 1		1.3 ulp
+//
+// The three part pi/2 reduction of sin and cos runs out of bits above 8192
+// and the error grows from there. Infinite or NaN input gives NaN. acos
+// returns NaN outside [-1, 1]. atan2(0, 0) is 0, -0 is treated as +0 for x
+// and two infinite inputs give NaN.
+
+// mask ? a : b
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_select(glm_vec4 mask, glm_vec4 a, glm_vec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_blendv_ps(b, a, mask);
+#	else
+		glm_vec4 const and0 = _mm_and_ps(mask, a);
+		glm_vec4 const and1 = _mm_andnot_ps(mask, b);
+		return _mm_or_ps(and0, and1);
+#	endif
+}
+
+// r in [-pi/4, pi/4]
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_kernel(glm_vec4 r, glm_vec4 r2)
+{
+	glm_vec4 const mad0 = glm_vec4_fma(r2, _mm_set1_ps(-1.9515295891e-4f), _mm_set1_ps(8.3321608736e-3f));
+	glm_vec4 const mad1 = glm_vec4_fma(r2, mad0, _mm_set1_ps(-1.6666654611e-1f));
+	glm_vec4 const mul0 = glm_vec4_mul(glm_vec4_mul(r2, r), mad1);
+	return glm_vec4_add(r, mul0);
+}
+
+// r in [-pi/4, pi/4]
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_kernel(glm_vec4 r2)
+{
+	glm_vec4 const mad0 = glm_vec4_fma(r2, _mm_set1_ps(2.443315711809948e-5f), _mm_set1_ps(-1.388731625493765e-3f));
+	glm_vec4 const mad1 = glm_vec4_fma(r2, mad0, _mm_set1_ps(4.166664568298827e-2f));
+	glm_vec4 const mul0 = glm_vec4_mul(glm_vec4_mul(r2, r2), mad1);
+	glm_vec4 const mad2 = glm_vec4_fma(r2, _mm_set1_ps(-0.5f), _mm_set1_ps(1.0f));
+	return glm_vec4_add(mad2, mul0);
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	// x = j * pi/2 + r, with pi/2 split in three parts so j * part is exact
+	glm_vec4 const j = glm_vec4_round(glm_vec4_mul(x, _mm_set1_ps(0.636619772367581343f)));
+	glm_vec4 const r0 = glm_vec4_fma(j, _mm_set1_ps(-1.5703125f), x);
+	glm_vec4 const r1 = glm_vec4_fma(j, _mm_set1_ps(-4.837512969970703125e-4f), r0);
+	glm_vec4 const r = glm_vec4_fma(j, _mm_set1_ps(-7.549789954891882e-8f), r1);
+	glm_vec4 const r2 = glm_vec4_mul(r, r);
+
+	glm_vec4 const sin0 = glm_vec4_sin_kernel(r, r2);
+	glm_vec4 const cos0 = glm_vec4_cos_kernel(r2);
+
+	// Quadrant: odd ones swap sin and cos, sin flips sign in 2 and 3, cos
+	// in 1 and 2.
+	glm_ivec4 const q = _mm_cvttps_epi32(j);
+	glm_ivec4 const one = _mm_set1_epi32(1);
+	glm_vec4 const swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+	glm_vec4 const sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+	glm_vec4 const cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), _mm_set1_epi32(2)), 30));
+
+	*s = _mm_xor_ps(glm_vec4_select(swap, cos0, sin0), sinSign);
+	*c = _mm_xor_ps(glm_vec4_select(swap, sin0, cos0), cosSign);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return s;
+}
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan2(glm_vec4 y, glm_vec4 x)
+{
+	glm_vec4 const sgn0 = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)));
+	glm_vec4 const ax = glm_vec4_abs(x);
+	glm_vec4 const ay = glm_vec4_abs(y);
+
+	// atan of min / max is in [0, pi/4], 0 / 0 is taken as 0
+	glm_vec4 const mn = _mm_min_ps(ax, ay);
+	glm_vec4 const mx = _mm_max_ps(ax, ay);
+	glm_vec4 const zro = _mm_cmpeq_ps(mx, _mm_setzero_ps());
+	glm_vec4 const a = _mm_andnot_ps(zro, glm_vec4_div(mn, mx));
+
+	// Above tan(pi/8) use atan(a) = pi/4 + atan((a - 1) / (a + 1))
+	glm_vec4 const big = _mm_cmpgt_ps(a, _mm_set1_ps(0.414213562373095f));
+	glm_vec4 const t = glm_vec4_select(big, glm_vec4_div(glm_vec4_sub(a, _mm_set1_ps(1.0f)), glm_vec4_add(a, _mm_set1_ps(1.0f))), a);
+	glm_vec4 const t2 = glm_vec4_mul(t, t);
+	glm_vec4 const mad0 = glm_vec4_fma(t2, _mm_set1_ps(8.05374449538e-2f), _mm_set1_ps(-1.38776856032e-1f));
+	glm_vec4 const mad1 = glm_vec4_fma(t2, mad0, _mm_set1_ps(1.99777106478e-1f));
+	glm_vec4 const mad2 = glm_vec4_fma(t2, mad1, _mm_set1_ps(-3.33329491539e-1f));
+	glm_vec4 const mad3 = glm_vec4_fma(glm_vec4_mul(t2, t), mad2, t);
+	glm_vec4 const r0 = glm_vec4_add(mad3, _mm_and_ps(big, _mm_set1_ps(0.785398163397448f)));
+
+	// Unfold the octant, then the quadrant, then the sign of y
+	glm_vec4 const r1 = glm_vec4_select(_mm_cmpgt_ps(ay, ax), glm_vec4_sub(_mm_set1_ps(1.57079632679489662f), r0), r0);
+	glm_vec4 const r2 = glm_vec4_select(_mm_cmplt_ps(x, _mm_setzero_ps()), glm_vec4_sub(_mm_set1_ps(3.14159265358979324f), r1), r1);
+	return _mm_or_ps(r2, _mm_and_ps(y, sgn0));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_acos(glm_vec4 x)
+{
+	glm_vec4 const ax = glm_vec4_abs(x);
+
+	// Above 0.5 use acos(|x|) = 2 * asin(sqrt((1 - |x|) / 2))
+	glm_vec4 const big = _mm_cmpgt_ps(ax, _mm_set1_ps(0.5f));
+	glm_vec4 const zbig = glm_vec4_mul(glm_vec4_sub(_mm_set1_ps(1.0f), ax), _mm_set1_ps(0.5f));
+	glm_vec4 const z = glm_vec4_select(big, zbig, glm_vec4_mul(x, x));
+	glm_vec4 const s = glm_vec4_select(big, _mm_sqrt_ps(zbig), x);
+
+	glm_vec4 const mad0 = glm_vec4_fma(z, _mm_set1_ps(4.2163199048e-2f), _mm_set1_ps(2.4181311049e-2f));
+	glm_vec4 const mad1 = glm_vec4_fma(z, mad0, _mm_set1_ps(4.5470025998e-2f));
+	glm_vec4 const mad2 = glm_vec4_fma(z, mad1, _mm_set1_ps(7.4953002686e-2f));
+	glm_vec4 const mad3 = glm_vec4_fma(z, mad2, _mm_set1_ps(1.6666752422e-1f));
+	glm_vec4 const asin0 = glm_vec4_fma(glm_vec4_mul(z, s), mad3, s);
+
+	// Small: pi/2 - asin(x). Big: 2 * asin, mirrored to pi - 2 * asin for x < 0.
+	glm_vec4 const small0 = glm_vec4_sub(_mm_set1_ps(1.57079632679489662f), asin0);
+	glm_vec4 const twice0 = glm_vec4_add(asin0, asin0);
+	glm_vec4 const neg0 = _mm_cmplt_ps(x, _mm_setzero_ps());
+	glm_vec4 const big0 = glm_vec4_select(neg0, glm_vec4_sub(_mm_set1_ps(3.14159265358979324f), twice0), twice0);
+	return glm_vec4_select(big, big0, small0);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
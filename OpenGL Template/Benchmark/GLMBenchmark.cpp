@@ -0,0 +1,452 @@
+//
+//  GLMBenchmark.cpp
+//  OpenGL Template
+//
+//  Created by Aaron Elkins on 10/19/26.
+//  Copyright © 2026 Aaron Elkins. All rights reserved.
+//
+//  Throughput of the glm functions the demos lean on, printed as one JSON
+//  object. run.sh builds it once per glm configuration, GLM_FORCE_* and
+//  -m flags decide which code paths are measured. Every case maps Count
+//  inputs to Count outputs and reports the best of Runs runs in
+//  nanoseconds per element, so two result files compare key by key.
+
+#define GLM_ENABLE_EXPERIMENTAL
+// Every case shares this translation unit, and GCC's inlining budget is
+// per unit: without forcing, one more case could leave glm's operators
+// out of line in the others and make them 40 times slower.
+#define GLM_FORCE_INLINE
+#include <glm/glm.hpp>
+#include <glm/gtc/color_space.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/noise.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/gtx/color_space_array.hpp>
+#include <glm/gtx/intersect_array.hpp>
+#include <glm/gtx/matrix_inverse_array.hpp>
+#include <glm/gtx/morton_sort.hpp>
+#include <glm/gtx/noise_array.hpp>
+#include <glm/gtx/random_stream.hpp>
+#include <glm/gtx/spline_array.hpp>
+#include <glm/gtx/transform_array.hpp>
+#include <glm/simd/cpu.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#ifndef BENCH_CONFIG
+#define BENCH_CONFIG "default"
+#endif
+
+// Inputs per case: the vectors stay in L1, matrices and quaternions in L2.
+static const int Count = 1024;
+static const int Runs = 7;
+// Each run repeats the case until it takes at least this long.
+static const double MinRunSeconds = 0.01;
+
+typedef glm::mat<4, 4, float, glm::aligned_highp> aligned_mat4;
+
+// Keeps the compiler from dropping or hoisting work it can see is unused
+// or repeated between passes.
+static inline void clobber(const void *p)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "r"(p) : "memory");
+#else
+    static const void *volatile sink;
+    sink = p;
+#endif
+}
+
+// Inputs
+static glm::vec3 A3[Count], B3[Count];
+static glm::vec4 A4[Count], B4[Count];
+static glm::aligned_vec4 AlignedA4[Count], AlignedB4[Count];
+static glm::mat4 MatA[Count], MatB[Count];
+static aligned_mat4 AlignedMatA[Count], AlignedMatB[Count];
+static glm::quat QuatA[Count], QuatB[Count];
+static float Scalars[Count];
+static glm::vec2 Unit2[Count];
+static glm::vec4 Unit4[Count];
+static glm::vec4 Signed4[Count];
+static glm::aligned_vec4 AlignedSigned4[Count];
+static glm::uint32 Packed[Count];
+// Packed as halves, x then y of each Unit2 * 100
+static glm::vec2 Scaled2[Count];
+static glm::uint16 Halves[2 * Count];
+// Primitives for the hit tests, one array per coordinate
+static float Coords[9][Count];
+
+// Outputs
+static float OutF[Count];
+static float OutX[Count], OutY[Count];
+static glm::vec3 Out3[Count];
+static glm::vec4 Out4[Count];
+static glm::aligned_vec4 AlignedOut4[Count];
+static glm::vec2 Out2[Count];
+static glm::mat4 OutMat[Count];
+static aligned_mat4 AlignedOutMat[Count];
+static glm::quat OutQuat[Count];
+static glm::uint32 OutPacked[Count];
+static glm::uint16 OutHalves[2 * Count];
+static glm::u8vec4 OutColors[Count];
+static bool OutFlags[Count];
+
+// Deterministic inputs, the same in every configuration
+static unsigned int seed = 1;
+static float nextRandom(float lo, float hi)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return lo + (hi - lo) * float(seed >> 8) * (1.0f / 16777216.0f);
+}
+
+static glm::mat4 randomMatrix()
+{
+    // A rotation, scale and translation, so inverse() stays well conditioned
+    glm::mat4 m = glm::translate(glm::mat4(1.0f), glm::vec3(nextRandom(-100, 100), nextRandom(-100, 100), nextRandom(-1, 1)));
+    m = glm::rotate(m, nextRandom(0, 6.28f), glm::normalize(glm::vec3(nextRandom(-1, 1), nextRandom(-1, 1), nextRandom(0.1f, 1))));
+    return glm::scale(m, glm::vec3(nextRandom(0.5f, 2), nextRandom(0.5f, 2), nextRandom(0.5f, 2)));
+}
+
+static void initInputs()
+{
+    for (int i = 0; i < Count; i++) {
+        A3[i] = glm::vec3(nextRandom(-10, 10), nextRandom(-10, 10), nextRandom(0.1f, 10));
+        B3[i] = glm::vec3(nextRandom(-10, 10), nextRandom(-10, 10), nextRandom(-10, 10));
+        A4[i] = glm::vec4(A3[i], nextRandom(0.1f, 10));
+        B4[i] = glm::vec4(B3[i], nextRandom(-10, 10));
+        AlignedA4[i] = glm::aligned_vec4(A4[i]);
+        AlignedB4[i] = glm::aligned_vec4(B4[i]);
+        MatA[i] = randomMatrix();
+        MatB[i] = randomMatrix();
+        AlignedMatA[i] = aligned_mat4(MatA[i]);
+        AlignedMatB[i] = aligned_mat4(MatB[i]);
+        QuatA[i] = glm::angleAxis(nextRandom(0, 3.14f), glm::normalize(B3[i] + glm::vec3(0, 0, 20)));
+        QuatB[i] = glm::angleAxis(nextRandom(0, 3.14f), glm::normalize(A3[i]));
+        Scalars[i] = nextRandom(0, 1);
+        Unit2[i] = glm::vec2(nextRandom(-1, 1), nextRandom(-1, 1));
+        Unit4[i] = glm::vec4(nextRandom(0, 1), nextRandom(0, 1), nextRandom(0, 1), nextRandom(0, 1));
+        Signed4[i] = Unit4[i] * 2.0f - 1.0f;
+        AlignedSigned4[i] = glm::aligned_vec4(Signed4[i]);
+        Scaled2[i] = Unit2[i] * 100.0f;
+        Packed[i] = glm::packHalf2x16(Scaled2[i]);
+        Halves[2 * i + 0] = glm::packHalf1x16(Scaled2[i].x);
+        Halves[2 * i + 1] = glm::packHalf1x16(Scaled2[i].y);
+        for (int k = 0; k < 9; k++)
+            Coords[k][i] = nextRandom(-10, 10);
+    }
+}
+
+// Seconds for one pass over all Count inputs, best of Runs
+template<typename Case>
+static double measure(Case run)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    // Warm up, then find how many passes fill MinRunSeconds
+    run();
+    int passes = 1;
+    for (;;) {
+        Clock::time_point start = Clock::now();
+        for (int p = 0; p < passes; p++)
+            run();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (seconds >= MinRunSeconds)
+            break;
+        passes *= 2;
+    }
+
+    double best = 1e30;
+    for (int r = 0; r < Runs; r++) {
+        Clock::time_point start = Clock::now();
+        for (int p = 0; p < passes; p++)
+            run();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count() / passes;
+        if (seconds < best)
+            best = seconds;
+    }
+    return best;
+}
+
+static bool firstResult = true;
+
+template<typename Case>
+static void bench(const char *name, Case run)
+{
+    double ns = measure(run) * 1e9 / Count;
+    printf("%s\n    \"%s\": %.3f", firstResult ? "" : ",", name, ns);
+    firstResult = false;
+    fflush(stdout);
+}
+
+// Each case is a lambda doing one pass. The inputs never change, the
+// clobber after every pass makes each one count.
+#define BENCH_CASE(name, out, expression) \
+    bench(name, [](){ \
+        for (int i = 0; i < Count; i++) \
+            out[i] = expression; \
+        clobber(out); \
+    })
+
+static void runAll()
+{
+    // Geometric
+    BENCH_CASE("normalize_vec3", Out3, glm::normalize(A3[i]));
+    BENCH_CASE("normalize_vec4", Out4, glm::normalize(A4[i]));
+    BENCH_CASE("normalize_aligned_vec4", AlignedOut4, glm::normalize(AlignedA4[i]));
+    BENCH_CASE("dot_vec3", OutF, glm::dot(A3[i], B3[i]));
+    BENCH_CASE("dot_vec4", OutF, glm::dot(A4[i], B4[i]));
+    BENCH_CASE("dot_aligned_vec4", OutF, glm::dot(AlignedA4[i], AlignedB4[i]));
+    BENCH_CASE("cross_vec3", Out3, glm::cross(A3[i], B3[i]));
+
+    // Matrices
+    BENCH_CASE("mat4_mul_mat4", OutMat, MatA[i] * MatB[i]);
+    BENCH_CASE("mat4_mul_mat4_aligned", AlignedOutMat, AlignedMatA[i] * AlignedMatB[i]);
+    BENCH_CASE("mat4_mul_vec4", Out4, MatA[i] * A4[i]);
+    BENCH_CASE("mat4_mul_vec4_aligned", AlignedOut4, AlignedMatA[i] * AlignedA4[i]);
+    BENCH_CASE("mat4_inverse", OutMat, glm::inverse(MatA[i]));
+    BENCH_CASE("mat4_inverse_aligned", AlignedOutMat, glm::inverse(AlignedMatA[i]));
+    bench("mat4_inverse_array", [](){
+        glm::inverse(MatA, OutMat, Count);
+        clobber(OutMat);
+    });
+    bench("mat4_inverse_guarded_array", [](){
+        glm::inverseGuarded(MatA, OutMat, Count, 1e-6f, OutFlags);
+        clobber(OutMat);
+    });
+    BENCH_CASE("mat4_transpose", OutMat, glm::transpose(MatA[i]));
+    BENCH_CASE("mat4_transpose_aligned", AlignedOutMat, glm::transpose(AlignedMatA[i]));
+    BENCH_CASE("ortho", OutMat, glm::ortho(A4[i].x, A4[i].x + 640.0f, A4[i].y + 480.0f, A4[i].y));
+    BENCH_CASE("ortho_depth", OutMat, glm::ortho(A4[i].x, A4[i].x + 640.0f, A4[i].y + 480.0f, A4[i].y, -1.0f, A4[i].z));
+
+    // Count vec4 through one matrix, with the kernel the CPU gets and with
+    // each kernel the CPU can run
+    bench("transform_vec4_array", [](){
+        glm::transform(A4, MatA[0], Out4, Count);
+        clobber(Out4);
+    });
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_SIMD_DISPATCH
+    static glm_vec4 const Columns[4] = {_mm_loadu_ps(&MatA[0][0].x), _mm_loadu_ps(&MatA[0][1].x), _mm_loadu_ps(&MatA[0][2].x), _mm_loadu_ps(&MatA[0][3].x)};
+    bench("transform_vec4_array_sse", [](){
+        glm_mat4_mul_vec4_array_sse(Columns, &A4[0].x, &Out4[0].x, Count);
+        clobber(Out4);
+    });
+    if (glm_cpu_arch() & GLM_ARCH_AVX_BIT) {
+        bench("transform_vec4_array_avx", [](){
+            glm_mat4_mul_vec4_array_avx(Columns, &A4[0].x, &Out4[0].x, Count);
+            clobber(Out4);
+        });
+    }
+    if (glm_cpu_arch() & GLM_ARCH_AVX2_BIT) {
+        bench("transform_vec4_array_fma", [](){
+            glm_mat4_mul_vec4_array_fma(Columns, &A4[0].x, &Out4[0].x, Count);
+            clobber(Out4);
+        });
+    }
+#endif
+
+    // Trigonometry, per component scalar for vec4 and SIMD for aligned_vec4
+    BENCH_CASE("sin_vec4", Out4, glm::sin(A4[i]));
+    BENCH_CASE("sin_aligned_vec4", AlignedOut4, glm::sin(AlignedA4[i]));
+    BENCH_CASE("cos_vec4", Out4, glm::cos(A4[i]));
+    BENCH_CASE("cos_aligned_vec4", AlignedOut4, glm::cos(AlignedA4[i]));
+    BENCH_CASE("atan2_vec4", Out4, glm::atan(A4[i], B4[i]));
+    BENCH_CASE("atan2_aligned_vec4", AlignedOut4, glm::atan(AlignedA4[i], AlignedB4[i]));
+    BENCH_CASE("acos_vec4", Out4, glm::acos(Signed4[i]));
+    BENCH_CASE("acos_aligned_vec4", AlignedOut4, glm::acos(AlignedSigned4[i]));
+
+    // Quaternions
+    BENCH_CASE("quat_slerp", OutQuat, glm::slerp(QuatA[i], QuatB[i], Scalars[i]));
+
+    // Hit tests, one query against Count primitives
+    bench("nearest_segment", [](){
+        const float *a[2] = {Coords[0], Coords[1]}, *b[2] = {Coords[2], Coords[3]};
+        size_t index;
+        glm::nearestSegment(A3[0], a, b, Count, 0.5f, index, OutF[0]);
+        clobber(OutF);
+    });
+    bench("nearest_circle", [](){
+        const float *center[2] = {Coords[0], Coords[1]};
+        size_t index;
+        glm::nearestCircle(A3[0], center, Scalars, Count, index, OutF[0]);
+        clobber(OutF);
+    });
+    bench("nearest_arc", [](){
+        const float *center[2] = {Coords[0], Coords[1]}, *direction[2] = {Coords[2], Coords[3]};
+        size_t index;
+        glm::nearestArc(A3[0], center, Scalars, Coords[4], direction, Coords[5], Count, index, OutF[0]);
+        clobber(OutF);
+    });
+    bench("intersect_ray_triangles", [](){
+        const float *v0[3] = {Coords[0], Coords[1], Coords[2]};
+        const float *v1[3] = {Coords[3], Coords[4], Coords[5]};
+        const float *v2[3] = {Coords[6], Coords[7], Coords[8]};
+        size_t index;
+        glm::vec2 bary;
+        glm::intersectRayTriangles(B3[0], glm::normalize(A3[0]), v0, v1, v2, Count, index, bary, OutF[0]);
+        clobber(OutF);
+    });
+
+    // Noise, Coords[0] and Coords[1] as points
+    BENCH_CASE("perlin_vec2", OutF, glm::perlin(glm::vec2(Coords[0][i], Coords[1][i])));
+    BENCH_CASE("simplex_vec2", OutF, glm::simplex(glm::vec2(Coords[0][i], Coords[1][i])));
+    bench("perlin_array", [](){
+        glm::perlin(Coords[0], Coords[1], OutF, Count);
+        clobber(OutF);
+    });
+    bench("simplex_array", [](){
+        glm::simplex(Coords[0], Coords[1], OutF, Count);
+        clobber(OutF);
+    });
+
+    // Morton order, Coords[0] and Coords[1] as points
+    bench("morton_encode", [](){
+        glm::mortonEncode(Coords[0], Coords[1], Count, glm::vec2(-10.0f), glm::vec2(10.0f), OutPacked);
+        clobber(OutPacked);
+    });
+    bench("morton_sort", [](){
+        glm::mortonSort(Coords[0], Coords[1], Count, glm::vec2(-10.0f), glm::vec2(10.0f), OutPacked, 1);
+        clobber(OutPacked);
+    });
+
+    // Splines, one Catmull-Rom span through A3[0..3] sampled Count times
+    BENCH_CASE("catmullRom_vec2", Out2, glm::catmullRom(glm::vec2(A3[0]), glm::vec2(A3[1]), glm::vec2(A3[2]), glm::vec2(A3[3]), float(i) / float(Count)));
+    bench("catmullRom_array", [](){
+        glm::catmullRom(glm::vec2(A3[0]), glm::vec2(A3[1]), glm::vec2(A3[2]), glm::vec2(A3[3]), Count, OutX, OutY);
+        clobber(OutX);
+        clobber(OutY);
+    });
+
+    // Random points, gtc_random on std::rand against a randomStream
+    static glm::randomStream Stream(1);
+    BENCH_CASE("diskRand_vec2", Out2, glm::diskRand(1.0f));
+    bench("diskRand_array", [](){
+        glm::diskRand(Stream, 1.0f, OutX, OutY, Count);
+        clobber(OutX);
+        clobber(OutY);
+    });
+    bench("linearRand_array", [](){
+        glm::linearRand(Stream, -10.0f, 10.0f, OutF, Count);
+        clobber(OutF);
+    });
+
+    // Colors, Unit4 as linear RGBA
+    BENCH_CASE("srgb_encode_vec4", Out4, glm::convertLinearToSRGB(Unit4[i]));
+    bench("srgb_encode_array", [](){
+        glm::convertLinearToSRGB(Unit4, OutColors, Count);
+        clobber(OutColors);
+    });
+    bench("srgb_decode_array", [](){
+        glm::convertSRGBToLinear(OutColors, Out4, Count);
+        clobber(Out4);
+    });
+
+    // Packing, one value at a time and in bulk. The half arrays take two
+    // halves per element, as packHalf2x16 does.
+    BENCH_CASE("packHalf2x16", OutPacked, glm::packHalf2x16(Scaled2[i]));
+    bench("packHalf2x16_array", [](){
+        glm::packHalfArray(&Scaled2[0].x, OutHalves, 2 * Count);
+        clobber(OutHalves);
+    });
+    BENCH_CASE("unpackHalf2x16", Out2, glm::unpackHalf2x16(Packed[i]));
+    bench("unpackHalf2x16_array", [](){
+        glm::unpackHalfArray(Halves, &Out2[0].x, 2 * Count);
+        clobber(Out2);
+    });
+    BENCH_CASE("packSnorm2x16", OutPacked, glm::packSnorm2x16(Unit2[i]));
+    bench("packSnorm2x16_array", [](){
+        glm::packSnorm2x16Array(Unit2, OutPacked, Count);
+        clobber(OutPacked);
+    });
+    BENCH_CASE("unpackSnorm2x16", Out2, glm::unpackSnorm2x16(Packed[i]));
+    bench("unpackSnorm2x16_array", [](){
+        glm::unpackSnorm2x16Array(Packed, Out2, Count);
+        clobber(Out2);
+    });
+    BENCH_CASE("packUnorm4x8", OutPacked, glm::packUnorm4x8(Unit4[i]));
+    bench("packUnorm4x8_array", [](){
+        glm::packUnorm4x8Array(Unit4, OutPacked, Count);
+        clobber(OutPacked);
+    });
+    BENCH_CASE("unpackUnorm4x8", Out4, glm::unpackUnorm4x8(Packed[i]));
+    bench("unpackUnorm4x8_array", [](){
+        glm::unpackUnorm4x8Array(Packed, Out4, Count);
+        clobber(Out4);
+    });
+}
+
+static const char *archName(int arch)
+{
+    if (arch == GLM_ARCH_PURE)
+        return "pure";
+    if (arch & GLM_ARCH_AVX512_BIT)
+        return "avx512";
+    if (arch & GLM_ARCH_AVX2_BIT)
+        return "avx2";
+    if (arch & GLM_ARCH_AVX_BIT)
+        return "avx";
+    if (arch & GLM_ARCH_SSE42_BIT)
+        return "sse4.2";
+    if (arch & GLM_ARCH_SSE41_BIT)
+        return "sse4.1";
+    if (arch & GLM_ARCH_SSSE3_BIT)
+        return "ssse3";
+    if (arch & GLM_ARCH_SSE3_BIT)
+        return "sse3";
+    if (arch & GLM_ARCH_SSE2_BIT)
+        return "sse2";
+    if (arch & GLM_ARCH_NEON_BIT)
+        return "neon";
+    return "other";
+}
+
+// The instruction set of the running CPU, as named by archName()
+static const char *cpuArchName()
+{
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_SIMD_DISPATCH
+    return archName(glm_cpu_arch());
+#else
+    return "unknown";
+#endif
+}
+
+static const char *compilerName()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    // run.sh asks the default build what the CPU can run before starting
+    // the others.
+    if (argc > 1 && strcmp(argv[1], "--cpu") == 0) {
+        printf("%s\n", cpuArchName());
+        return 0;
+    }
+
+    initInputs();
+
+    printf("{\n");
+    printf("  \"config\": \"%s\",\n", BENCH_CONFIG);
+    printf("  \"glm_arch\": \"%s\",\n", archName(GLM_ARCH));
+    printf("  \"cpu\": \"%s\",\n", cpuArchName());
+    printf("  \"compiler\": \"%s\",\n", compilerName());
+    printf("  \"count\": %d,\n", Count);
+    printf("  \"unit\": \"ns per element\",\n");
+    printf("  \"results\": {");
+    runAll();
+    printf("\n  }\n}\n");
+    return 0;
+}
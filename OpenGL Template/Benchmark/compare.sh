@@ -0,0 +1,41 @@
+#!/bin/sh
+#
+#  compare.sh
+#  OpenGL Template
+#
+#  Created by Aaron Elkins on 10/19/26.
+#  Copyright © 2026 Aaron Elkins. All rights reserved.
+#
+#  Compares two run.sh outputs case by case, within each configuration
+#  both ran, and lists the cases that got more than LIMIT times slower
+#  (3 by default, above the run to run noise of a busy machine):
+#
+#    ./run.sh > after.json
+#    ./compare.sh baseline.json after.json
+#
+#  Exits with 1 when a case is listed, so a case added next to the others
+#  cannot make them slower unnoticed. Timings from another machine only
+#  compare against their own baseline.
+
+LIMIT=${LIMIT:-3}
+
+# One "config case ns" line per result
+results() {
+    awk '
+        /"config":/ { gsub(/[",]/, "", $2); config = $2 }
+        /^    "[^"]*": [0-9.]+,?$/ { gsub(/[",:]/, "", $1); gsub(/,/, "", $2); print config, $1, $2 }
+    ' "$1"
+}
+
+results "$1" > "${TMPDIR:-/tmp}/glm-benchmark-before"
+results "$2" | awk -v limit="$LIMIT" '
+    NR == FNR { before[$1 " " $2] = $3; next }
+    ($1 " " $2) in before {
+        ratio = $3 / before[$1 " " $2]
+        if (ratio > limit) {
+            printf "%s %s: %.3f -> %.3f ns (%.1fx)\n", $1, $2, before[$1 " " $2], $3, ratio
+            slower = 1
+        }
+    }
+    END { exit slower }
+' "${TMPDIR:-/tmp}/glm-benchmark-before" -
@@ -0,0 +1,71 @@
+#!/bin/sh
+#
+#  run.sh
+#  OpenGL Template
+#
+#  Created by Aaron Elkins on 10/19/26.
+#  Copyright © 2026 Aaron Elkins. All rights reserved.
+#
+#  Builds GLMBenchmark.cpp against the glm next to it once per
+#  configuration and prints a JSON array with one result object each:
+#
+#    ./run.sh > before.json
+#    ./run.sh default avx > after.json
+#
+#  compare.sh lists the cases slower than in baseline.json, the results
+#  of the last change to the suite; rerun it into baseline.json whenever
+#  cases are added.
+#
+#  Without arguments every configuration runs. CXX and CXXFLAGS are taken
+#  from the environment. Configurations the CPU cannot run are skipped
+#  with a note on stderr.
+
+set -e
+
+cd "$(dirname "$0")"
+CXX=${CXX:-c++}
+BUILD=${TMPDIR:-/tmp}/glm-benchmark
+mkdir -p "$BUILD"
+
+CONFIGS=${*:-"default sse2 avx pure"}
+
+# Compiler flags and the CPU feature each configuration needs
+flags() {
+    case $1 in
+        default) echo "" ;;
+        sse2) echo "-DGLM_FORCE_SSE2 -msse2" ;;
+        avx) echo "-DGLM_FORCE_AVX -mavx" ;;
+        pure) echo "-DGLM_FORCE_PURE" ;;
+        *) echo "run.sh: unknown configuration $1" >&2; exit 1 ;;
+    esac
+}
+
+needs() {
+    case $1 in
+        avx) echo "avx avx2 avx512" ;;
+        *) echo "" ;;
+    esac
+}
+
+build() {
+    $CXX -std=c++11 -O2 $CXXFLAGS $(flags "$1") -DBENCH_CONFIG="\"$1\"" -I.. GLMBenchmark.cpp -o "$BUILD/$1"
+}
+
+# The default build reports what the CPU supports
+build default
+CPU=$("$BUILD/default" --cpu)
+
+echo "["
+FIRST=1
+for CONFIG in $CONFIGS; do
+    NEEDS=$(needs "$CONFIG")
+    if [ -n "$NEEDS" ] && ! echo " $NEEDS " | grep -q " $CPU "; then
+        echo "run.sh: skipping $CONFIG, the CPU supports $CPU" >&2
+        continue
+    fi
+    [ "$CONFIG" = default ] || build "$CONFIG"
+    [ $FIRST = 1 ] || echo ","
+    FIRST=0
+    "$BUILD/$CONFIG"
+done
+echo "]"
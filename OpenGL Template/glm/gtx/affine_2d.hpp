@@ -0,0 +1,81 @@
+/// @ref gtx_affine_2d
+/// @file glm/gtx/affine_2d.hpp
+///
+/// @see core (dependence)
+/// @see gtx_matrix_transform_2d
+/// @see gtx_transform_array
+///
+/// @defgroup gtx_affine_2d GLM_GTX_affine_2d
+/// @ingroup gtx
+///
+/// Include <glm/gtx/affine_2d.hpp> to use the features of this extension.
+///
+/// 2D affine transforms as 3x2 matrices: the two columns of the linear part
+/// and the translation, 6 values instead of the 9 of gtx_matrix_transform_2d
+/// or the 16 of a mat4. The matrix rows, row(m, 0) and row(m, 1) from
+/// gtc_matrix_access, are the two vec3 a shader dots with vec3(p, 1).
+/// Points are transformed by m * vec3(p, 1), or whole arrays at a time by
+/// transform() from gtx_transform_array. Everything but affineRotate and
+/// affineInverse is constexpr, in every GLM_ARCH.
+
+#pragma once
+
+// Dependency:
+#include "../mat3x2.hpp"
+#include "../vec2.hpp"
+#include "transform_array.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_affine_2d is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_affine_2d extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_affine_2d
+	/// @{
+
+	/// The x and y rows of ortho(left, right, bottom, top, zNear, zFar),
+	/// which do not depend on the depth range.
+	///
+	/// @see gtc_matrix_transform
+	template<typename T>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<3, 2, T, defaultp> affineOrtho(
+		T left, T right, T bottom, T top);
+
+	/// a * b: the transform applying b, then a.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<3, 2, T, Q> affineCompose(
+		mat<3, 2, T, Q> const& a,
+		mat<3, 2, T, Q> const& b);
+
+	/// The transform undoing m. m must not be singular.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 2, T, Q> affineInverse(
+		mat<3, 2, T, Q> const& m);
+
+	/// m translated by v, in the space m maps from.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<3, 2, T, Q> affineTranslate(
+		mat<3, 2, T, Q> const& m,
+		vec<2, T, Q> const& v);
+
+	/// m rotated by angle, in radians.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 2, T, Q> affineRotate(
+		mat<3, 2, T, Q> const& m,
+		T angle);
+
+	/// m scaled by v.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<3, 2, T, Q> affineScale(
+		mat<3, 2, T, Q> const& m,
+		vec<2, T, Q> const& v);
+
+	/// @}
+}//namespace glm
+
+#include "affine_2d.inl"
@@ -0,0 +1,89 @@
+/// @ref gtx_intersect_array
+/// @file glm/gtx/intersect_array.hpp
+///
+/// @see core (dependence)
+/// @see gtx_intersect
+///
+/// @defgroup gtx_intersect_array GLM_GTX_intersect_array
+/// @ingroup gtx
+///
+/// Include <glm/gtx/intersect_array.hpp> to use the features of this extension.
+///
+/// Hit tests of one point or ray against whole arrays of primitives, for
+/// hover and picking. Primitives are stored as structures of arrays, one
+/// float array per coordinate, so with SSE2 the glm/simd/intersect.h
+/// kernels test 4 of them at once, 8 when the CPU has AVX. Each function
+/// returns whether anything was hit and the index of the nearest hit;
+/// ties go to the lowest index.
+
+#pragma once
+
+// Dependency:
+#include "../vec2.hpp"
+#include "../vec3.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_intersect_array is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_intersect_array extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_intersect_array
+	/// @{
+
+	/// The segment from (a[0][i], a[1][i]) to (b[0][i], b[1][i]) nearest to
+	/// point, among the count segments closer than maxDistance to it.
+	/// distance receives how far it is.
+	///
+	/// @see gtx_intersect_array
+	GLM_FUNC_DECL bool nearestSegment(
+		vec2 const& point,
+		float const* const a[2], float const* const b[2], std::size_t count,
+		float maxDistance, std::size_t& index, float& distance);
+
+	/// Among the count circles of center (center[0][i], center[1][i]) and
+	/// radius radius[i] holding point, the one whose center is nearest.
+	/// distance receives how far that center is.
+	///
+	/// @see gtx_intersect_array
+	GLM_FUNC_DECL bool nearestCircle(
+		vec2 const& point,
+		float const* const center[2], float const* radius, std::size_t count,
+		std::size_t& index, float& distance);
+
+	/// Among the count arcs holding point, the one whose center is nearest.
+	/// Arc i covers the ring from innerRadius[i] to outerRadius[i] around
+	/// its center, within the angle whose cosine is cosHalfAngle[i] of the
+	/// unit vector (direction[0][i], direction[1][i]). An arc from angle a0
+	/// to a1 has direction (cos((a0 + a1) / 2), sin((a0 + a1) / 2)) and
+	/// cosHalfAngle cos((a1 - a0) / 2). A zero inner radius gives a pie
+	/// slice, a stroke of width w runs from radius - w / 2 to radius + w / 2.
+	///
+	/// @see gtx_intersect_array
+	GLM_FUNC_DECL bool nearestArc(
+		vec2 const& point,
+		float const* const center[2], float const* innerRadius, float const* outerRadius,
+		float const* const direction[2], float const* cosHalfAngle, std::size_t count,
+		std::size_t& index, float& distance);
+
+	/// The nearest of the count triangles v0 v1 v2 hit by the ray orig +
+	/// distance * dir, distance >= 0, seen from either side. v0[k][i] is
+	/// coordinate k of the first vertex of triangle i. baryPosition
+	/// receives the barycentric position of the hit, as in
+	/// intersectRayTriangle.
+	///
+	/// @see gtx_intersect_array
+	GLM_FUNC_DECL bool intersectRayTriangles(
+		vec3 const& orig, vec3 const& dir,
+		float const* const v0[3], float const* const v1[3], float const* const v2[3], std::size_t count,
+		std::size_t& index, vec2& baryPosition, float& distance);
+
+	/// @}
+}//namespace glm
+
+#include "intersect_array.inl"
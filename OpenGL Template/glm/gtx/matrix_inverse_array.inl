@@ -0,0 +1,35 @@
+/// @ref gtx_matrix_inverse_array
+/// @file glm/gtx/matrix_inverse_array.inl
+
+#include "../simd/matrix.h"
+
+namespace glm
+{
+	GLM_FUNC_QUALIFIER void inverse(mat4 const* in, mat4* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_mat4_inverse_array(reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count, false, 0.0f, NULL);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = inverse(in[i]);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t inverseGuarded(mat4 const* in, mat4* out, std::size_t count, float minDeterminant, bool* invertible)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return glm_mat4_inverse_array(reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count, true, minDeterminant, invertible);
+#		else
+			std::size_t singular = 0;
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				bool const ok = abs(determinant(in[i])) > minDeterminant;
+				out[i] = ok ? inverse(in[i]) : mat4(0.0f);
+				if(invertible)
+					invertible[i] = ok;
+				singular += ok ? 0 : 1;
+			}
+			return singular;
+#		endif
+	}
+}//namespace glm
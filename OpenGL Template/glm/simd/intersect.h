@@ -0,0 +1,427 @@
+/// @ref simd
+/// @file glm/simd/intersect.h
+
+#pragma once
+
+#include "common.h"
+#include "cpu.h"
+#include <cstddef>
+#include <limits>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Packet versions of the hit tests of gtx/intersect_array. Primitives come
+// as structures of arrays, one float array per coordinate, and 4 (SSE) or
+// 8 (AVX) of them are tested at once. Each kernel keeps in *best and
+// *index the smallest value found so far and where it was, runs from
+// first over whole packets, and returns where it stopped; the caller
+// finishes the tail. Misses count as +infinity and never replace *best.
+
+// Records the lanes of value below *best, the first one of equal values,
+// and returns the new *best.
+GLM_FUNC_QUALIFIER float glm_nearest_lanes(float const* value, int width, std::size_t i, float* best, std::size_t* index)
+{
+	for(int j = 0; j < width; ++j)
+		if(value[j] < *best)
+		{
+			*best = value[j];
+			*index = i + j;
+		}
+	return *best;
+}
+
+// Misses of hit replaced by +infinity
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_hit_or_inf(glm_vec4 hit, glm_vec4 v)
+{
+	glm_vec4 const inf0 = _mm_set1_ps(std::numeric_limits<float>::infinity());
+	return _mm_or_ps(_mm_and_ps(hit, v), _mm_andnot_ps(hit, inf0));
+}
+
+// Squared distance from (px, py) to the segments a to b. Degenerate
+// segments, where t is 0 / 0, measure from a: max returns 0 for NaN.
+GLM_FUNC_QUALIFIER std::size_t glm_nearest_segment_sse(float px, float py, float const* ax, float const* ay, float const* bx, float const* by, std::size_t first, std::size_t count, float* best, std::size_t* index)
+{
+	glm_vec4 const px0 = _mm_set1_ps(px);
+	glm_vec4 const py0 = _mm_set1_ps(py);
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 best0 = _mm_set1_ps(*best);
+
+	std::size_t i = first;
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_vec4 const ax0 = _mm_loadu_ps(ax + i);
+		glm_vec4 const ay0 = _mm_loadu_ps(ay + i);
+		glm_vec4 const abx = _mm_sub_ps(_mm_loadu_ps(bx + i), ax0);
+		glm_vec4 const aby = _mm_sub_ps(_mm_loadu_ps(by + i), ay0);
+		glm_vec4 const apx = _mm_sub_ps(px0, ax0);
+		glm_vec4 const apy = _mm_sub_ps(py0, ay0);
+
+		glm_vec4 const dot0 = _mm_add_ps(_mm_mul_ps(apx, abx), _mm_mul_ps(apy, aby));
+		glm_vec4 const len0 = _mm_add_ps(_mm_mul_ps(abx, abx), _mm_mul_ps(aby, aby));
+		glm_vec4 const t0 = _mm_min_ps(_mm_max_ps(_mm_div_ps(dot0, len0), zero), one);
+
+		glm_vec4 const dx = _mm_sub_ps(apx, _mm_mul_ps(t0, abx));
+		glm_vec4 const dy = _mm_sub_ps(apy, _mm_mul_ps(t0, aby));
+		glm_vec4 const d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+		if(_mm_movemask_ps(_mm_cmplt_ps(d2, best0)))
+		{
+			float value[4];
+			_mm_storeu_ps(value, d2);
+			best0 = _mm_set1_ps(glm_nearest_lanes(value, 4, i, best, index));
+		}
+	}
+	return i;
+}
+
+// Squared distance from (px, py) to the centers of the circles holding it
+GLM_FUNC_QUALIFIER std::size_t glm_nearest_circle_sse(float px, float py, float const* cx, float const* cy, float const* radius, std::size_t first, std::size_t count, float* best, std::size_t* index)
+{
+	glm_vec4 const px0 = _mm_set1_ps(px);
+	glm_vec4 const py0 = _mm_set1_ps(py);
+	glm_vec4 best0 = _mm_set1_ps(*best);
+
+	std::size_t i = first;
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_vec4 const dx = _mm_sub_ps(px0, _mm_loadu_ps(cx + i));
+		glm_vec4 const dy = _mm_sub_ps(py0, _mm_loadu_ps(cy + i));
+		glm_vec4 const r0 = _mm_loadu_ps(radius + i);
+		glm_vec4 const d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+		glm_vec4 const hit = _mm_cmple_ps(d2, _mm_mul_ps(r0, r0));
+		glm_vec4 const value0 = glm_vec4_hit_or_inf(hit, d2);
+
+		if(_mm_movemask_ps(_mm_cmplt_ps(value0, best0)))
+		{
+			float value[4];
+			_mm_storeu_ps(value, value0);
+			best0 = _mm_set1_ps(glm_nearest_lanes(value, 4, i, best, index));
+		}
+	}
+	return i;
+}
+
+// Squared distance from (px, py) to the centers of the arcs holding it: a
+// ring from inner to outer radius, cut to the directions within the angle
+// whose cosine is cosHalf of (dirX, dirY).
+GLM_FUNC_QUALIFIER std::size_t glm_nearest_arc_sse(float px, float py, float const* cx, float const* cy, float const* inner, float const* outer, float const* dirX, float const* dirY, float const* cosHalf, std::size_t first, std::size_t count, float* best, std::size_t* index)
+{
+	glm_vec4 const px0 = _mm_set1_ps(px);
+	glm_vec4 const py0 = _mm_set1_ps(py);
+	glm_vec4 best0 = _mm_set1_ps(*best);
+
+	std::size_t i = first;
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_vec4 const dx = _mm_sub_ps(px0, _mm_loadu_ps(cx + i));
+		glm_vec4 const dy = _mm_sub_ps(py0, _mm_loadu_ps(cy + i));
+		glm_vec4 const in0 = _mm_loadu_ps(inner + i);
+		glm_vec4 const out0 = _mm_loadu_ps(outer + i);
+		glm_vec4 const d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+		glm_vec4 const along = _mm_add_ps(_mm_mul_ps(dx, _mm_loadu_ps(dirX + i)), _mm_mul_ps(dy, _mm_loadu_ps(dirY + i)));
+		glm_vec4 const cone = _mm_cmpge_ps(along, _mm_mul_ps(_mm_sqrt_ps(d2), _mm_loadu_ps(cosHalf + i)));
+		glm_vec4 const ring = _mm_and_ps(_mm_cmpge_ps(d2, _mm_mul_ps(in0, in0)), _mm_cmple_ps(d2, _mm_mul_ps(out0, out0)));
+		glm_vec4 const value0 = glm_vec4_hit_or_inf(_mm_and_ps(ring, cone), d2);
+
+		if(_mm_movemask_ps(_mm_cmplt_ps(value0, best0)))
+		{
+			float value[4];
+			_mm_storeu_ps(value, value0);
+			best0 = _mm_set1_ps(glm_nearest_lanes(value, 4, i, best, index));
+		}
+	}
+	return i;
+}
+
+// Distance t along the ray o + t * d to the triangles v0 v1 v2 it hits,
+// from either side, with t >= 0. Moller-Trumbore, v0[k] being the array
+// of coordinate k of the first vertices.
+GLM_FUNC_QUALIFIER std::size_t glm_nearest_ray_triangle_sse(float const o[3], float const d[3], float const* const v0[3], float const* const v1[3], float const* const v2[3], std::size_t first, std::size_t count, float* best, std::size_t* index)
+{
+	glm_vec4 const ox = _mm_set1_ps(o[0]);
+	glm_vec4 const oy = _mm_set1_ps(o[1]);
+	glm_vec4 const oz = _mm_set1_ps(o[2]);
+	glm_vec4 const dx = _mm_set1_ps(d[0]);
+	glm_vec4 const dy = _mm_set1_ps(d[1]);
+	glm_vec4 const dz = _mm_set1_ps(d[2]);
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const eps = _mm_set1_ps(std::numeric_limits<float>::epsilon());
+	glm_vec4 best0 = _mm_set1_ps(*best);
+
+	std::size_t i = first;
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_vec4 const ax = _mm_loadu_ps(v0[0] + i);
+		glm_vec4 const ay = _mm_loadu_ps(v0[1] + i);
+		glm_vec4 const az = _mm_loadu_ps(v0[2] + i);
+		glm_vec4 const e1x = _mm_sub_ps(_mm_loadu_ps(v1[0] + i), ax);
+		glm_vec4 const e1y = _mm_sub_ps(_mm_loadu_ps(v1[1] + i), ay);
+		glm_vec4 const e1z = _mm_sub_ps(_mm_loadu_ps(v1[2] + i), az);
+		glm_vec4 const e2x = _mm_sub_ps(_mm_loadu_ps(v2[0] + i), ax);
+		glm_vec4 const e2y = _mm_sub_ps(_mm_loadu_ps(v2[1] + i), ay);
+		glm_vec4 const e2z = _mm_sub_ps(_mm_loadu_ps(v2[2] + i), az);
+
+		// p = cross(d, e2), det = dot(e1, p)
+		glm_vec4 const pvx = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+		glm_vec4 const pvy = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+		glm_vec4 const pvz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+		glm_vec4 const det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, pvx), _mm_mul_ps(e1y, pvy)), _mm_mul_ps(e1z, pvz));
+		glm_vec4 const rcp = _mm_div_ps(one, det);
+
+		// u = dot(o - v0, p) / det
+		glm_vec4 const tvx = _mm_sub_ps(ox, ax);
+		glm_vec4 const tvy = _mm_sub_ps(oy, ay);
+		glm_vec4 const tvz = _mm_sub_ps(oz, az);
+		glm_vec4 const u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tvx, pvx), _mm_mul_ps(tvy, pvy)), _mm_mul_ps(tvz, pvz)), rcp);
+
+		// q = cross(o - v0, e1), v = dot(d, q) / det, t = dot(e2, q) / det
+		glm_vec4 const qvx = _mm_sub_ps(_mm_mul_ps(tvy, e1z), _mm_mul_ps(tvz, e1y));
+		glm_vec4 const qvy = _mm_sub_ps(_mm_mul_ps(tvz, e1x), _mm_mul_ps(tvx, e1z));
+		glm_vec4 const qvz = _mm_sub_ps(_mm_mul_ps(tvx, e1y), _mm_mul_ps(tvy, e1x));
+		glm_vec4 const v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qvx), _mm_mul_ps(dy, qvy)), _mm_mul_ps(dz, qvz)), rcp);
+		glm_vec4 const t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qvx), _mm_mul_ps(e2y, qvy)), _mm_mul_ps(e2z, qvz)), rcp);
+
+		glm_vec4 const hit0 = _mm_cmpgt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), det), eps);
+		glm_vec4 const hit1 = _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmpge_ps(v, zero));
+		glm_vec4 const hit2 = _mm_and_ps(_mm_cmple_ps(_mm_add_ps(u, v), one), _mm_cmpge_ps(t, zero));
+		glm_vec4 const value0 = glm_vec4_hit_or_inf(_mm_and_ps(hit0, _mm_and_ps(hit1, hit2)), t);
+
+		if(_mm_movemask_ps(_mm_cmplt_ps(value0, best0)))
+		{
+			float value[4];
+			_mm_storeu_ps(value, value0);
+			best0 = _mm_set1_ps(glm_nearest_lanes(value, 4, i, best, index));
+		}
+	}
+	return i;
+}
+
+#if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+GLM_SIMD_TARGET("avx") inline __m256 glm_vec8_hit_or_inf(__m256 hit, __m256 v)
+{
+	return _mm256_blendv_ps(_mm256_set1_ps(std::numeric_limits<float>::infinity()), v, hit);
+}
+
+GLM_SIMD_TARGET("avx") inline std::size_t glm_nearest_segment_avx(float px, float py, float const* ax, float const* ay, float const* bx, float const* by, std::size_t first, std::size_t count, float* best, std::size_t* index)
+{
+	__m256 const px0 = _mm256_set1_ps(px);
+	__m256 const py0 = _mm256_set1_ps(py);
+	__m256 const zero = _mm256_setzero_ps();
+	__m256 const one = _mm256_set1_ps(1.0f);
+	__m256 best0 = _mm256_set1_ps(*best);
+
+	std::size_t i = first;
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256 const ax0 = _mm256_loadu_ps(ax + i);
+		__m256 const ay0 = _mm256_loadu_ps(ay + i);
+		__m256 const abx = _mm256_sub_ps(_mm256_loadu_ps(bx + i), ax0);
+		__m256 const aby = _mm256_sub_ps(_mm256_loadu_ps(by + i), ay0);
+		__m256 const apx = _mm256_sub_ps(px0, ax0);
+		__m256 const apy = _mm256_sub_ps(py0, ay0);
+
+		__m256 const dot0 = _mm256_add_ps(_mm256_mul_ps(apx, abx), _mm256_mul_ps(apy, aby));
+		__m256 const len0 = _mm256_add_ps(_mm256_mul_ps(abx, abx), _mm256_mul_ps(aby, aby));
+		__m256 const t0 = _mm256_min_ps(_mm256_max_ps(_mm256_div_ps(dot0, len0), zero), one);
+
+		__m256 const dx = _mm256_sub_ps(apx, _mm256_mul_ps(t0, abx));
+		__m256 const dy = _mm256_sub_ps(apy, _mm256_mul_ps(t0, aby));
+		__m256 const d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+
+		if(_mm256_movemask_ps(_mm256_cmp_ps(d2, best0, _CMP_LT_OQ)))
+		{
+			float value[8];
+			_mm256_storeu_ps(value, d2);
+			best0 = _mm256_set1_ps(glm_nearest_lanes(value, 8, i, best, index));
+		}
+	}
+	return i;
+}
+
+GLM_SIMD_TARGET("avx") inline std::size_t glm_nearest_circle_avx(float px, float py, float const* cx, float const* cy, float const* radius, std::size_t first, std::size_t count, float* best, std::size_t* index)
+{
+	__m256 const px0 = _mm256_set1_ps(px);
+	__m256 const py0 = _mm256_set1_ps(py);
+	__m256 best0 = _mm256_set1_ps(*best);
+
+	std::size_t i = first;
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256 const dx = _mm256_sub_ps(px0, _mm256_loadu_ps(cx + i));
+		__m256 const dy = _mm256_sub_ps(py0, _mm256_loadu_ps(cy + i));
+		__m256 const r0 = _mm256_loadu_ps(radius + i);
+		__m256 const d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+		__m256 const hit = _mm256_cmp_ps(d2, _mm256_mul_ps(r0, r0), _CMP_LE_OQ);
+		__m256 const value0 = glm_vec8_hit_or_inf(hit, d2);
+
+		if(_mm256_movemask_ps(_mm256_cmp_ps(value0, best0, _CMP_LT_OQ)))
+		{
+			float value[8];
+			_mm256_storeu_ps(value, value0);
+			best0 = _mm256_set1_ps(glm_nearest_lanes(value, 8, i, best, index));
+		}
+	}
+	return i;
+}
+
+GLM_SIMD_TARGET("avx") inline std::size_t glm_nearest_arc_avx(float px, float py, float const* cx, float const* cy, float const* inner, float const* outer, float const* dirX, float const* dirY, float const* cosHalf, std::size_t first, std::size_t count, float* best, std::size_t* index)
+{
+	__m256 const px0 = _mm256_set1_ps(px);
+	__m256 const py0 = _mm256_set1_ps(py);
+	__m256 best0 = _mm256_set1_ps(*best);
+
+	std::size_t i = first;
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256 const dx = _mm256_sub_ps(px0, _mm256_loadu_ps(cx + i));
+		__m256 const dy = _mm256_sub_ps(py0, _mm256_loadu_ps(cy + i));
+		__m256 const in0 = _mm256_loadu_ps(inner + i);
+		__m256 const out0 = _mm256_loadu_ps(outer + i);
+		__m256 const d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+
+		__m256 const along = _mm256_add_ps(_mm256_mul_ps(dx, _mm256_loadu_ps(dirX + i)), _mm256_mul_ps(dy, _mm256_loadu_ps(dirY + i)));
+		__m256 const cone = _mm256_cmp_ps(along, _mm256_mul_ps(_mm256_sqrt_ps(d2), _mm256_loadu_ps(cosHalf + i)), _CMP_GE_OQ);
+		__m256 const ring = _mm256_and_ps(_mm256_cmp_ps(d2, _mm256_mul_ps(in0, in0), _CMP_GE_OQ), _mm256_cmp_ps(d2, _mm256_mul_ps(out0, out0), _CMP_LE_OQ));
+		__m256 const value0 = glm_vec8_hit_or_inf(_mm256_and_ps(ring, cone), d2);
+
+		if(_mm256_movemask_ps(_mm256_cmp_ps(value0, best0, _CMP_LT_OQ)))
+		{
+			float value[8];
+			_mm256_storeu_ps(value, value0);
+			best0 = _mm256_set1_ps(glm_nearest_lanes(value, 8, i, best, index));
+		}
+	}
+	return i;
+}
+
+GLM_SIMD_TARGET("avx") inline std::size_t glm_nearest_ray_triangle_avx(float const o[3], float const d[3], float const* const v0[3], float const* const v1[3], float const* const v2[3], std::size_t first, std::size_t count, float* best, std::size_t* index)
+{
+	__m256 const ox = _mm256_set1_ps(o[0]);
+	__m256 const oy = _mm256_set1_ps(o[1]);
+	__m256 const oz = _mm256_set1_ps(o[2]);
+	__m256 const dx = _mm256_set1_ps(d[0]);
+	__m256 const dy = _mm256_set1_ps(d[1]);
+	__m256 const dz = _mm256_set1_ps(d[2]);
+	__m256 const zero = _mm256_setzero_ps();
+	__m256 const one = _mm256_set1_ps(1.0f);
+	__m256 const eps = _mm256_set1_ps(std::numeric_limits<float>::epsilon());
+	__m256 best0 = _mm256_set1_ps(*best);
+
+	std::size_t i = first;
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256 const ax = _mm256_loadu_ps(v0[0] + i);
+		__m256 const ay = _mm256_loadu_ps(v0[1] + i);
+		__m256 const az = _mm256_loadu_ps(v0[2] + i);
+		__m256 const e1x = _mm256_sub_ps(_mm256_loadu_ps(v1[0] + i), ax);
+		__m256 const e1y = _mm256_sub_ps(_mm256_loadu_ps(v1[1] + i), ay);
+		__m256 const e1z = _mm256_sub_ps(_mm256_loadu_ps(v1[2] + i), az);
+		__m256 const e2x = _mm256_sub_ps(_mm256_loadu_ps(v2[0] + i), ax);
+		__m256 const e2y = _mm256_sub_ps(_mm256_loadu_ps(v2[1] + i), ay);
+		__m256 const e2z = _mm256_sub_ps(_mm256_loadu_ps(v2[2] + i), az);
+
+		__m256 const pvx = _mm256_sub_ps(_mm256_mul_ps(dy, e2z), _mm256_mul_ps(dz, e2y));
+		__m256 const pvy = _mm256_sub_ps(_mm256_mul_ps(dz, e2x), _mm256_mul_ps(dx, e2z));
+		__m256 const pvz = _mm256_sub_ps(_mm256_mul_ps(dx, e2y), _mm256_mul_ps(dy, e2x));
+		__m256 const det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e1x, pvx), _mm256_mul_ps(e1y, pvy)), _mm256_mul_ps(e1z, pvz));
+		__m256 const rcp = _mm256_div_ps(one, det);
+
+		__m256 const tvx = _mm256_sub_ps(ox, ax);
+		__m256 const tvy = _mm256_sub_ps(oy, ay);
+		__m256 const tvz = _mm256_sub_ps(oz, az);
+		__m256 const u = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(tvx, pvx), _mm256_mul_ps(tvy, pvy)), _mm256_mul_ps(tvz, pvz)), rcp);
+
+		__m256 const qvx = _mm256_sub_ps(_mm256_mul_ps(tvy, e1z), _mm256_mul_ps(tvz, e1y));
+		__m256 const qvy = _mm256_sub_ps(_mm256_mul_ps(tvz, e1x), _mm256_mul_ps(tvx, e1z));
+		__m256 const qvz = _mm256_sub_ps(_mm256_mul_ps(tvx, e1y), _mm256_mul_ps(tvy, e1x));
+		__m256 const v = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, qvx), _mm256_mul_ps(dy, qvy)), _mm256_mul_ps(dz, qvz)), rcp);
+		__m256 const t = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2x, qvx), _mm256_mul_ps(e2y, qvy)), _mm256_mul_ps(e2z, qvz)), rcp);
+
+		__m256 const hit0 = _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), det), eps, _CMP_GT_OQ);
+		__m256 const hit1 = _mm256_and_ps(_mm256_cmp_ps(u, zero, _CMP_GE_OQ), _mm256_cmp_ps(v, zero, _CMP_GE_OQ));
+		__m256 const hit2 = _mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_LE_OQ), _mm256_cmp_ps(t, zero, _CMP_GE_OQ));
+		__m256 const value0 = glm_vec8_hit_or_inf(_mm256_and_ps(hit0, _mm256_and_ps(hit1, hit2)), t);
+
+		if(_mm256_movemask_ps(_mm256_cmp_ps(value0, best0, _CMP_LT_OQ)))
+		{
+			float value[8];
+			_mm256_storeu_ps(value, value0);
+			best0 = _mm256_set1_ps(glm_nearest_lanes(value, 8, i, best, index));
+		}
+	}
+	return i;
+}
+
+#endif//GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
+// The AVX kernel when the CPU runs it, then the SSE one on what is left.
+// Returns where the caller takes over.
+GLM_FUNC_QUALIFIER std::size_t glm_nearest_segment(float px, float py, float const* ax, float const* ay, float const* bx, float const* by, std::size_t count, float* best, std::size_t* index)
+{
+	std::size_t i = 0;
+#	if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+#		if GLM_SIMD_DISPATCH
+			int const Arch = GLM_ARCH | glm_cpu_arch();
+#		else
+			int const Arch = GLM_ARCH;
+#		endif
+
+		if(Arch & GLM_ARCH_AVX_BIT)
+			i = glm_nearest_segment_avx(px, py, ax, ay, bx, by, 0, count, best, index);
+#	endif
+	return glm_nearest_segment_sse(px, py, ax, ay, bx, by, i, count, best, index);
+}
+
+GLM_FUNC_QUALIFIER std::size_t glm_nearest_circle(float px, float py, float const* cx, float const* cy, float const* radius, std::size_t count, float* best, std::size_t* index)
+{
+	std::size_t i = 0;
+#	if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+#		if GLM_SIMD_DISPATCH
+			int const Arch = GLM_ARCH | glm_cpu_arch();
+#		else
+			int const Arch = GLM_ARCH;
+#		endif
+
+		if(Arch & GLM_ARCH_AVX_BIT)
+			i = glm_nearest_circle_avx(px, py, cx, cy, radius, 0, count, best, index);
+#	endif
+	return glm_nearest_circle_sse(px, py, cx, cy, radius, i, count, best, index);
+}
+
+GLM_FUNC_QUALIFIER std::size_t glm_nearest_arc(float px, float py, float const* cx, float const* cy, float const* inner, float const* outer, float const* dirX, float const* dirY, float const* cosHalf, std::size_t count, float* best, std::size_t* index)
+{
+	std::size_t i = 0;
+#	if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+#		if GLM_SIMD_DISPATCH
+			int const Arch = GLM_ARCH | glm_cpu_arch();
+#		else
+			int const Arch = GLM_ARCH;
+#		endif
+
+		if(Arch & GLM_ARCH_AVX_BIT)
+			i = glm_nearest_arc_avx(px, py, cx, cy, inner, outer, dirX, dirY, cosHalf, 0, count, best, index);
+#	endif
+	return glm_nearest_arc_sse(px, py, cx, cy, inner, outer, dirX, dirY, cosHalf, i, count, best, index);
+}
+
+GLM_FUNC_QUALIFIER std::size_t glm_nearest_ray_triangle(float const o[3], float const d[3], float const* const v0[3], float const* const v1[3], float const* const v2[3], std::size_t count, float* best, std::size_t* index)
+{
+	std::size_t i = 0;
+#	if GLM_SIMD_DISPATCH || (GLM_ARCH & GLM_ARCH_AVX_BIT)
+#		if GLM_SIMD_DISPATCH
+			int const Arch = GLM_ARCH | glm_cpu_arch();
+#		else
+			int const Arch = GLM_ARCH;
+#		endif
+
+		if(Arch & GLM_ARCH_AVX_BIT)
+			i = glm_nearest_ray_triangle_avx(o, d, v0, v1, v2, 0, count, best, index);
+#	endif
+	return glm_nearest_ray_triangle_sse(o, d, v0, v1, v2, i, count, best, index);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT